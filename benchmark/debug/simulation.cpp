@@ -0,0 +1,91 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Simulation loop typical of code that steps oscillators through time, for comparing unoptimized
+// builds on raw integers against frequencypp with and without FREQUENCYPP_FORCE_INLINE
+//
+// Defining FREQUENCYPP_BENCHMARK_RAW selects the raw integer version.  The program prints the mean
+// time per step in nanoseconds.
+
+#include <frequencypp/frequency_core.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr auto steps = std::int64_t{20'000'000};
+
+#if defined(FREQUENCYPP_BENCHMARK_RAW)
+
+// Frequencies are in hertz and kilohertz, and durations in nanoseconds
+auto simulate(std::int64_t base_khz, std::int64_t step_hz, std::int64_t dt_ns) -> std::int64_t
+{
+    auto cycles = std::int64_t{0};
+    auto above = std::int64_t{0};
+    auto f = base_khz * 1000;
+    for (auto i = std::int64_t{0}; i < steps; ++i) {
+        const auto target = base_khz * 1000 + (i % 7) * step_hz;
+        f += (target - f) / 2;
+        cycles += dt_ns * f / 1'000'000'000;
+        above += f > base_khz * 1000 ? 1 : 0;
+    }
+    return cycles + above;
+}
+
+#else
+
+auto simulate(frequencypp::kilohertz base, frequencypp::hertz step, std::chrono::nanoseconds dt)
+    -> std::int64_t
+{
+    auto cycles = std::int64_t{0};
+    auto above = std::int64_t{0};
+    auto f = frequencypp::hertz{base};
+    for (auto i = std::int64_t{0}; i < steps; ++i) {
+        const auto target = base + (i % 7) * step;
+        f += (target - f) / 2;
+        cycles += dt * f;
+        above += f > base ? 1 : 0;
+    }
+    return cycles + above;
+}
+
+#endif
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    static_cast<void>(argv);
+
+    // Derive the inputs from argc so that they are not constants
+    const auto base = 48 + argc;
+    const auto step = 100 + argc;
+    const auto dt = 20'000 + argc;
+
+    const auto start = std::chrono::steady_clock::now();
+#if defined(FREQUENCYPP_BENCHMARK_RAW)
+    const auto result = simulate(base, step, dt);
+#else
+    const auto result = simulate(frequencypp::kilohertz{base},
+        frequencypp::hertz{step},
+        std::chrono::nanoseconds{dt});
+#endif
+    const auto stop = std::chrono::steady_clock::now();
+
+    const auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::printf("%.2f %lld\n", ns / static_cast<double>(steps), static_cast<long long>(result));
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Measures the cost of updating and reading a frequency shared between threads
+//
+// Each thread count is measured for a raw std::atomic<std::int64_t>, for
+// frequencypp::atomic_frequency<hertz> updated with fetch_add and with a compare-and-exchange loop,
+// and for a hertz guarded by a mutex.  A final scenario has one thread retuning the frequency
+// while the others read it.
+
+#include <frequencypp/atomic.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr auto iterations = 1'000'000;
+
+// Run body(thread index) on each of the given number of threads at once, returning the mean time
+// per iteration of each thread in nanoseconds
+template<typename Body>
+auto run(int threads, Body body) -> double
+{
+    auto ready = std::atomic<int>{0};
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(static_cast<std::size_t>(threads));
+    const auto start = std::chrono::steady_clock::now();
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (ready.load() < threads) {
+            }
+            body(t);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+void report(const char* name, int threads, double ns)
+{
+    std::printf("  %-28s %2d threads  %8.2f ns/op\n", name, threads, ns);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    using frequencypp::hertz;
+    using frequencypp::kilohertz;
+
+    const auto hardware = static_cast<int>(std::thread::hardware_concurrency());
+    auto counts = std::vector<int>{1, 2, 4, 8};
+    if (hardware > 8) {
+        counts.push_back(hardware);
+    }
+
+    std::printf("Contended updates:\n");
+    for (const auto threads : counts) {
+        auto raw = std::atomic<std::int64_t>{0};
+        report("std::atomic<int64_t> add", threads, run(threads, [&](int) {
+            for (auto i = 0; i < iterations; ++i) {
+                raw.fetch_add(1000, std::memory_order_relaxed);
+            }
+        }));
+
+        auto f = frequencypp::atomic_frequency<hertz>{};
+        report("atomic_frequency fetch_add", threads, run(threads, [&](int) {
+            for (auto i = 0; i < iterations; ++i) {
+                f.fetch_add(kilohertz{1}, std::memory_order_relaxed);
+            }
+        }));
+
+        auto g = frequencypp::atomic_frequency<hertz>{};
+        report("atomic_frequency CAS loop", threads, run(threads, [&](int) {
+            for (auto i = 0; i < iterations; ++i) {
+                auto expected = g.load(std::memory_order_relaxed);
+                while (!g.compare_exchange_weak(expected, expected + kilohertz{1},
+                    std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                }
+            }
+        }));
+
+        auto m = std::mutex{};
+        auto h = hertz{};
+        report("mutex + hertz", threads, run(threads, [&](int) {
+            for (auto i = 0; i < iterations; ++i) {
+                const auto lock = std::lock_guard<std::mutex>{m};
+                h += kilohertz{1};
+            }
+        }));
+    }
+
+    std::printf("\nOne thread retuning while the others read:\n");
+    for (const auto threads : counts) {
+        if (threads < 2) {
+            continue;
+        }
+        auto f = frequencypp::atomic_frequency<hertz>{kilohertz{48}};
+        auto sink = std::atomic<std::int64_t>{0};
+        report("atomic_frequency load", threads, run(threads, [&](int t) {
+            auto sum = std::int64_t{0};
+            for (auto i = 0; i < iterations; ++i) {
+                if (t == 0) {
+                    f.store(kilohertz{48} + hertz{i % 100}, std::memory_order_release);
+                }
+                else {
+                    sum += f.load(std::memory_order_acquire).count();
+                }
+            }
+            sink.fetch_add(sum, std::memory_order_relaxed);
+        }));
+    }
+
+    return 0;
+}
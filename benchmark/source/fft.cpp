@@ -0,0 +1,119 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Compares the real-input transform of fft_plan against a textbook radix-2 transform of the same
+// samples as std::complex values
+//
+// Each size is transformed repeatedly and the time per transform is the fastest of several passes.
+// The error is the largest difference between the bins of the two transforms.
+
+#include <frequencypp/fft.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr auto passes = 20;
+
+// Keeps results alive without letting the compiler see through them
+volatile double sink = 0;
+
+// Run body() several times, returning the fastest time in microseconds
+template<typename Body>
+auto measure(Body body) -> double
+{
+    auto best = 1e300;
+    for (auto pass = 0; pass < passes; ++pass) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+    return best;
+}
+
+// Iterative radix-2 transform of complex values, computing the twiddle factors as it goes
+void textbook_fft(std::vector<std::complex<double>>& x)
+{
+    const auto n = x.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        auto bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(x[i], x[j]);
+        }
+    }
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        const auto w = std::polar(1.0, -2 * 3.14159265358979323846 / static_cast<double>(len));
+        for (std::size_t i = 0; i < n; i += len) {
+            auto wk = std::complex<double>{1};
+            for (std::size_t k = 0; k < len / 2; ++k) {
+                const auto t = wk * x[i + k + len / 2];
+                x[i + k + len / 2] = x[i + k] - t;
+                x[i + k] += t;
+                wk *= w;
+            }
+        }
+    }
+}
+
+template<std::size_t N>
+void run()
+{
+    using namespace frequencypp::literals;
+
+    auto samples = std::vector<double>(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        samples[i] = std::sin(0.01 * static_cast<double>(i * i % 7919));
+    }
+
+    const auto plan = frequencypp::make_fft_plan<N>(48_KHz);
+    auto s = typename decltype(plan)::spectrum_type{};
+    const auto planned = measure([&] { plan.transform(samples.data(), s); });
+
+    auto x = std::vector<std::complex<double>>(N);
+    const auto textbook = measure([&] {
+        std::copy(samples.begin(), samples.end(), x.begin());
+        textbook_fft(x);
+    });
+
+    auto error = 0.0;
+    for (std::size_t k = 0; k < s.size(); ++k) {
+        error = std::max(error, std::abs(s[k] - x[k]));
+    }
+    sink = s[1].real() + x[1].real();
+    std::printf("  %8zu %10.2f us %10.2f us %10.2e\n", N, planned, textbook, error);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    std::printf("  %8s %13s %13s %10s\n", "samples", "fft_plan", "textbook", "error");
+    run<256>();
+    run<1024>();
+    run<4096>();
+    run<16384>();
+    run<65536>();
+    return 0;
+}
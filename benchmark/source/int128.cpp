@@ -0,0 +1,184 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Compares 128-bit integer frequencies against long double frequencies for nanohertz resolution
+// over optical carrier frequencies, which exceed the range of std::int64_t nanohertz
+//
+// Each workload runs over a table of carriers between 190THz and 200THz.  The time per element is
+// the fastest of several passes, and the error is the number of results that differ from the
+// exact result computed with 128-bit integers.
+
+#include <frequencypp/frequency_core.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ratio>
+#include <vector>
+
+#if FREQUENCYPP_HAS_INT128
+
+namespace {
+
+using frequencypp::int128_t;
+
+using wide_nanohertz = frequencypp::frequency<int128_t, std::nano>;
+using float_nanohertz = frequencypp::frequency<long double, std::nano>;
+using float_hertz = frequencypp::frequency<long double>;
+
+constexpr auto count = std::size_t{1} << 16;
+constexpr auto passes = 20;
+
+// Keeps results alive without letting the compiler see through them
+volatile long double sink = 0;
+
+// Run body() several times, returning the fastest time per element in nanoseconds
+template<typename Body>
+auto measure(Body body) -> double
+{
+    auto best = 1e300;
+    for (auto pass = 0; pass < passes; ++pass) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    return best / static_cast<double>(count);
+}
+
+void report(const char* name, double wide, double floating, std::size_t errors)
+{
+    std::printf("  %-22s %8.2f ns  %8.2f ns  %8zu\n", name, wide, floating, errors);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    using frequencypp::frequency_cast;
+    using frequencypp::hertz;
+
+    // Carriers spaced by an odd number of nanohertz, so that most have nonzero low digits
+    auto wide = std::vector<wide_nanohertz>(count);
+    auto floating = std::vector<float_nanohertz>(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto n = int128_t{190000000000000} * 1000000000
+            + static_cast<int128_t>(i) * int128_t{152587890625001};
+        wide[i] = wide_nanohertz{n};
+        floating[i] = float_nanohertz{static_cast<long double>(n)};
+    }
+
+    std::printf("  %-22s %11s  %11s  %8s\n", "workload", "__int128", "long double", "errors");
+
+    {
+        auto wide_sum = wide_nanohertz{};
+        auto float_sum = float_nanohertz{};
+        const auto w = measure([&] {
+            wide_sum = wide_nanohertz{};
+            for (const auto f : wide) {
+                wide_sum += f;
+            }
+        });
+        const auto f = measure([&] {
+            float_sum = float_nanohertz{};
+            for (const auto v : floating) {
+                float_sum += v;
+            }
+        });
+        sink = float_sum.count() + static_cast<long double>(wide_sum.count());
+        const auto exact = static_cast<long double>(wide_sum.count()) == float_sum.count();
+        report("sum", w, f, exact ? 0 : 1);
+    }
+
+    {
+        auto wide_out = std::vector<hertz>(count);
+        auto float_out = std::vector<float_hertz>(count);
+        const auto w = measure([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                wide_out[i] = frequency_cast<hertz>(wide[i]);
+            }
+        });
+        const auto f = measure([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                float_out[i] = frequency_cast<float_hertz>(floating[i]);
+            }
+        });
+        auto errors = std::size_t{0};
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto truncated = static_cast<std::int64_t>(float_out[i].count());
+            errors += truncated != wide_out[i].count() ? 1 : 0;
+        }
+        sink = float_out.back().count() + static_cast<long double>(wide_out.back().count());
+        report("cast to hertz", w, f, errors);
+    }
+
+    {
+        const auto d = std::chrono::nanoseconds{1000003};
+        auto wide_out = std::vector<int128_t>(count);
+        auto float_out = std::vector<long double>(count);
+        const auto w = measure([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                wide_out[i] = wide[i] * d;
+            }
+        });
+        const auto f = measure([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                float_out[i] = floating[i] * d;
+            }
+        });
+        auto errors = std::size_t{0};
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto truncated = static_cast<int128_t>(float_out[i]);
+            errors += truncated != wide_out[i] ? 1 : 0;
+        }
+        sink = float_out.back() + static_cast<long double>(wide_out.back());
+        report("cycles in a duration", w, f, errors);
+    }
+
+    {
+        auto wide_out = std::vector<wide_nanohertz>(count);
+        auto float_out = std::vector<float_nanohertz>(count);
+        const auto w = measure([&] {
+            for (std::size_t i = 0; i + 1 < count; ++i) {
+                wide_out[i] = wide[i + 1] - wide[i];
+            }
+        });
+        const auto f = measure([&] {
+            for (std::size_t i = 0; i + 1 < count; ++i) {
+                float_out[i] = floating[i + 1] - floating[i];
+            }
+        });
+        auto errors = std::size_t{0};
+        for (std::size_t i = 0; i + 1 < count; ++i) {
+            const auto exact = static_cast<long double>(wide_out[i].count());
+            errors += float_out[i].count() != exact ? 1 : 0;
+        }
+        sink = float_out.front().count() + static_cast<long double>(wide_out.front().count());
+        report("channel spacing", w, f, errors);
+    }
+
+    return 0;
+}
+
+#else
+
+auto main() -> int
+{
+    std::printf("This compiler does not provide 128-bit integers\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,53 @@
+set(COMPILE_TIME_COMPILER c++ CACHE STRING "Compiler to measure the compile time with")
+set(COMPILE_TIME_REPETITIONS 10 CACHE STRING "Number of times each translation unit is compiled")
+
+add_custom_target(compile-time
+    COMMAND "${CMAKE_COMMAND}"
+    -D "COMPILER=${COMPILE_TIME_COMPILER}"
+    -D "REPETITIONS=${COMPILE_TIME_REPETITIONS}"
+    -P "${PROJECT_SOURCE_DIR}/cmake/compile-time.cmake"
+    WORKING_DIRECTORY "${PROJECT_SOURCE_DIR}"
+    COMMENT "Measuring compile time"
+    VERBATIM
+)
+
+set(MODULE_COMPILE_TIME_FLAGS -fmodules-ts
+    CACHE STRING "Flags enabling C++20 modules for the compile-time comparison"
+)
+set(MODULE_COMPILE_TIME_UNITS 100 CACHE STRING "Number of translation units to compile")
+
+add_custom_target(module-compile-time
+    COMMAND "${CMAKE_COMMAND}"
+    -D "COMPILER=${COMPILE_TIME_COMPILER}"
+    -D "MODULE_FLAGS=${MODULE_COMPILE_TIME_FLAGS}"
+    -D "UNITS=${MODULE_COMPILE_TIME_UNITS}"
+    -D "BINARY_DIR=${PROJECT_BINARY_DIR}/module-compile-time"
+    -P "${PROJECT_SOURCE_DIR}/cmake/module-compile-time.cmake"
+    WORKING_DIRECTORY "${PROJECT_SOURCE_DIR}"
+    COMMENT "Comparing the compile time of import and #include"
+    VERBATIM
+)
+
+set(INSTANTIATION_COMPILE_TIME_SIZES 16 64 256
+    CACHE STRING "Numbers of instantiations to generate for each configuration"
+)
+set(INSTANTIATION_COMPILE_TIME_BASELINE ""
+    CACHE FILEPATH "Results of a previous run to check for regressions against"
+)
+set(INSTANTIATION_COMPILE_TIME_THRESHOLD 10
+    CACHE STRING "Percentage by which a result may exceed the baseline"
+)
+
+add_custom_target(instantiation-compile-time
+    COMMAND "${CMAKE_COMMAND}"
+    -D "COMPILER=${COMPILE_TIME_COMPILER}"
+    -D "REPETITIONS=${COMPILE_TIME_REPETITIONS}"
+    -D "SIZES=${INSTANTIATION_COMPILE_TIME_SIZES}"
+    -D "BASELINE=${INSTANTIATION_COMPILE_TIME_BASELINE}"
+    -D "THRESHOLD=${INSTANTIATION_COMPILE_TIME_THRESHOLD}"
+    -D "BINARY_DIR=${PROJECT_BINARY_DIR}/instantiation-compile-time"
+    -P "${PROJECT_SOURCE_DIR}/cmake/instantiation-compile-time.cmake"
+    WORKING_DIRECTORY "${PROJECT_SOURCE_DIR}"
+    COMMENT "Measuring template instantiation cost"
+    VERBATIM
+)
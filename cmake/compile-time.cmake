@@ -0,0 +1,47 @@
+# Requires CMake 3.23 for microsecond timestamps
+cmake_minimum_required(VERSION 3.23)
+
+macro(default name)
+    if(NOT DEFINED "${name}")
+        set("${name}" "${ARGN}")
+    endif()
+endmacro()
+
+default(COMPILER c++)
+default(FLAGS -std=c++17 -O0)
+default(INCLUDE_DIR include)
+default(PATTERNS benchmark/compile-time/*.cpp)
+default(REPETITIONS 10)
+
+# Only the front end is run, as that is where the cost of including a header is paid
+file(GLOB files ${PATTERNS})
+list(SORT files)
+if(files STREQUAL "")
+    message(FATAL_ERROR "No translation units match '${PATTERNS}'")
+endif()
+
+message("Mean front-end time per translation unit over ${REPETITIONS} runs:\n")
+foreach(file IN LISTS files)
+    get_filename_component(name "${file}" NAME)
+    set(total 0)
+    foreach(i RANGE 1 "${REPETITIONS}")
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND "${COMPILER}" ${FLAGS} -I "${INCLUDE_DIR}" -fsyntax-only "${file}"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE error
+        )
+        string(TIMESTAMP stop "%s%f")
+        if(NOT result EQUAL "0")
+            message(FATAL_ERROR "'${file}': compiler returned with ${result}\n${error}")
+        endif()
+        math(EXPR total "${total} + ${stop} - ${start}")
+    endforeach()
+    math(EXPR mean "${total} / ${REPETITIONS} / 100")
+    math(EXPR whole "${mean} / 10")
+    math(EXPR tenth "${mean} % 10")
+    string(LENGTH "${name}" length)
+    math(EXPR padding "24 - ${length}")
+    string(REPEAT " " "${padding}" pad)
+    message("  ${name}${pad}${whole}.${tenth} ms")
+endforeach()
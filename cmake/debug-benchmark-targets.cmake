@@ -0,0 +1,11 @@
+set(DEBUG_BENCHMARK_COMPILER c++ CACHE STRING "Compiler to build the debug benchmark with")
+
+add_custom_target(debug-benchmark
+    COMMAND "${CMAKE_COMMAND}"
+    -D "COMPILER=${DEBUG_BENCHMARK_COMPILER}"
+    -D "BINARY_DIR=${PROJECT_BINARY_DIR}/debug-benchmark"
+    -P "${PROJECT_SOURCE_DIR}/cmake/debug-benchmark.cmake"
+    WORKING_DIRECTORY "${PROJECT_SOURCE_DIR}"
+    COMMENT "Measuring performance of unoptimized builds"
+    VERBATIM
+)
@@ -0,0 +1,53 @@
+cmake_minimum_required(VERSION 3.14)
+
+macro(default name)
+    if(NOT DEFINED "${name}")
+        set("${name}" "${ARGN}")
+    endif()
+endmacro()
+
+default(COMPILER c++)
+default(FLAGS -std=c++17 -g)
+default(LEVELS -O0 -Og)
+default(INCLUDE_DIR "${CMAKE_CURRENT_LIST_DIR}/../include")
+default(SOURCE "${CMAKE_CURRENT_LIST_DIR}/../benchmark/debug/simulation.cpp")
+default(BINARY_DIR build/debug-benchmark)
+
+get_filename_component(INCLUDE_DIR "${INCLUDE_DIR}" ABSOLUTE)
+get_filename_component(SOURCE "${SOURCE}" ABSOLUTE)
+get_filename_component(BINARY_DIR "${BINARY_DIR}" ABSOLUTE)
+file(MAKE_DIRECTORY "${BINARY_DIR}")
+
+set(variants raw frequency force_inline)
+set(raw_definitions -DFREQUENCYPP_BENCHMARK_RAW)
+set(frequency_definitions "")
+set(force_inline_definitions -DFREQUENCYPP_FORCE_INLINE)
+
+message("Mean time per simulation step:\n")
+foreach(level IN LISTS LEVELS)
+    message("  ${level}")
+    foreach(variant IN LISTS variants)
+        set(executable "${BINARY_DIR}/simulation_${variant}${level}")
+        execute_process(
+            COMMAND "${COMPILER}" ${FLAGS} "${level}" ${${variant}_definitions} -I "${INCLUDE_DIR}"
+                "${SOURCE}" -o "${executable}"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE error
+        )
+        if(NOT result EQUAL "0")
+            message(FATAL_ERROR "'${SOURCE}': compiler returned with ${result}\n${error}")
+        endif()
+        execute_process(
+            COMMAND "${executable}"
+            RESULT_VARIABLE result
+            OUTPUT_VARIABLE output
+        )
+        if(NOT result EQUAL "0" OR NOT output MATCHES "^([0-9.]+) ")
+            message(FATAL_ERROR "'${executable}' failed with ${result}")
+        endif()
+        string(LENGTH "${variant}" length)
+        math(EXPR padding "16 - ${length}")
+        string(REPEAT " " "${padding}" pad)
+        message("    ${variant}${pad}${CMAKE_MATCH_1} ns")
+    endforeach()
+endforeach()
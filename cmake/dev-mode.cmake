@@ -3,6 +3,11 @@ if(BUILD_TESTING)
     add_subdirectory(test)
 endif()
 
+option(BUILD_BENCHMARKS "Build the runtime benchmarks" ON)
+if(BUILD_BENCHMARKS)
+    add_subdirectory(benchmark)
+endif()
+
 option(BUILD_MCSS_DOCS "Build documentation using Doxygen and m.css" OFF)
 if(BUILD_MCSS_DOCS)
     include(cmake/docs.cmake)
@@ -15,3 +20,5 @@ endif()
 
 include(cmake/lint-targets.cmake)
 include(cmake/spell-targets.cmake)
+include(cmake/compile-time-targets.cmake)
+include(cmake/debug-benchmark-targets.cmake)
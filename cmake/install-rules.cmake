@@ -21,9 +21,33 @@ install(TARGETS frequencypp_frequencypp
     INCLUDES DESTINATION "${CMAKE_INSTALL_INCLUDEDIR}"
 )
 
+# The package is only architecture independent if it contains no compiled library
+set(arch_independent ARCH_INDEPENDENT)
+if(frequencypp_BUILD_PREBUILT)
+    install(TARGETS frequencypp_frequencypp_prebuilt
+        EXPORT frequencyppTargets
+        ARCHIVE DESTINATION "${CMAKE_INSTALL_LIBDIR}"
+        COMPONENT frequencypp_Development
+        INCLUDES DESTINATION "${CMAKE_INSTALL_INCLUDEDIR}"
+    )
+    set(arch_independent "")
+endif()
+if(frequencypp_BUILD_MODULE)
+    install(TARGETS frequencypp_frequencypp_module
+        EXPORT frequencyppTargets
+        ARCHIVE DESTINATION "${CMAKE_INSTALL_LIBDIR}"
+        COMPONENT frequencypp_Development
+        FILE_SET CXX_MODULES
+        DESTINATION "${CMAKE_INSTALL_DATADIR}/${package}/module"
+        COMPONENT frequencypp_Development
+        INCLUDES DESTINATION "${CMAKE_INSTALL_INCLUDEDIR}"
+    )
+    set(arch_independent "")
+endif()
+
 write_basic_package_version_file("${package}ConfigVersion.cmake"
     COMPATIBILITY SameMajorVersion
-    ARCH_INDEPENDENT
+    ${arch_independent}
 )
 
 # Allow package maintainers to freely override the path for the configs
@@ -0,0 +1,184 @@
+# Requires CMake 3.23 for microsecond timestamps
+cmake_minimum_required(VERSION 3.23)
+
+macro(default name)
+    if(NOT DEFINED "${name}")
+        set("${name}" "${ARGN}")
+    endif()
+endmacro()
+
+default(COMPILER c++)
+default(FLAGS -std=c++17)
+default(INCLUDE_DIR "${CMAKE_CURRENT_LIST_DIR}/../include")
+default(BINARY_DIR build/instantiation-compile-time)
+default(SIZES 16 64 256)
+default(REPETITIONS 3)
+default(BASELINE "")
+default(THRESHOLD 10)
+
+get_filename_component(INCLUDE_DIR "${INCLUDE_DIR}" ABSOLUTE)
+get_filename_component(BINARY_DIR "${BINARY_DIR}" ABSOLUTE)
+
+set(prologue "#include <frequencypp/frequency_core.hpp>\n\n#include <cstdint>\n#include <ratio>\n")
+
+# N distinct pairs of periods, each of which instantiates std::common_type, the converting
+# constructor, and the arithmetic and comparison operators for a new pair of types
+function(write_period_pairs path n)
+    set(body "${prologue}\nauto period_pairs() -> std::int64_t\n{\n")
+    string(APPEND body "    auto sum = std::int64_t{0};\n")
+    math(EXPR last "${n} - 1")
+    foreach(i RANGE 0 "${last}")
+        math(EXPR den "${i} + 1")
+        math(EXPR num "${i} + 2")
+        string(APPEND body "    {
+        const auto a = frequencypp::frequency<std::int64_t, std::ratio<1, ${den}>>{${num}};
+        const auto b = frequencypp::frequency<std::int64_t, std::ratio<${num}, 1>>{${den}};
+        sum += (a + b).count() + (a - b).count() + (a < b ? 1 : 0) + (a / b);
+    }\n")
+    endforeach()
+    string(APPEND body "    return sum;\n}\n")
+    file(WRITE "${path}" "${body}")
+endfunction()
+
+# A single expression of N terms alternating over a few types, which repeatedly resolves
+# overloads and common types for deep expressions of already instantiated types
+function(write_arithmetic_chain path n)
+    set(types frequencypp::hertz frequencypp::kilohertz frequencypp::millihertz
+        frequencypp::megahertz)
+    set(body "${prologue}\nauto arithmetic_chain() -> std::int64_t\n{\n")
+    string(APPEND body "    const auto r = frequencypp::hertz{1}")
+    math(EXPR last "${n} - 1")
+    foreach(i RANGE 0 "${last}")
+        math(EXPR t "${i} % 4")
+        list(GET types "${t}" type)
+        math(EXPR op "${i} % 3")
+        if(op EQUAL "0")
+            string(APPEND body "\n        + ${type}{${i}}")
+        elseif(op EQUAL "1")
+            string(APPEND body "\n        - ${type}{${i}} * 2")
+        else()
+            string(APPEND body "\n        + ${type}{${i}} / 3")
+        endif()
+    endforeach()
+    string(APPEND body ";\n    return r.count();\n}\n")
+    file(WRITE "${path}" "${body}")
+endfunction()
+
+# N statements mixing integral and floating-point literals of different units
+function(write_literal_mix path n)
+    set(suffixes _mHz _Hz _KHz _MHz _GHz)
+    set(body "${prologue}\nauto literal_mix() -> long double\n{\n")
+    string(APPEND body "    using namespace frequencypp::literals;\n    auto sum = 0.0L;\n")
+    math(EXPR last "${n} - 1")
+    foreach(i RANGE 0 "${last}")
+        math(EXPR s1 "${i} % 5")
+        math(EXPR s2 "(${i} + 2) % 5")
+        list(GET suffixes "${s1}" a)
+        list(GET suffixes "${s2}" b)
+        string(APPEND body "    sum += (${i}${a} + ${i}.5${b}).count();\n")
+    endforeach()
+    string(APPEND body "    return sum;\n}\n")
+    file(WRITE "${path}" "${body}")
+endfunction()
+
+# Compile ${source} for its front end only, storing the mean wall time in microseconds in
+# ${time_out} and the memory reported by GCC's -ftime-report in kilobytes, if any, in ${memory_out}
+function(measure time_out memory_out source)
+    set(total 0)
+    set(memory "")
+    foreach(i RANGE 1 "${REPETITIONS}")
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND "${COMPILER}" ${FLAGS} -I "${INCLUDE_DIR}" -fsyntax-only -ftime-report
+                "${source}"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE report
+        )
+        string(TIMESTAMP stop "%s%f")
+        if(NOT result EQUAL "0")
+            message(FATAL_ERROR "'${source}': compiler returned with ${result}\n${report}")
+        endif()
+        math(EXPR total "${total} + ${stop} - ${start}")
+    endforeach()
+    set(number "[0-9.]+[ ]+")
+    if(report MATCHES "TOTAL[ ]+:[ ]+${number}${number}${number}([0-9]+)([kMG]?)")
+        set(memory "${CMAKE_MATCH_1}")
+        if(CMAKE_MATCH_2 STREQUAL "")
+            math(EXPR memory "${memory} / 1024")
+        elseif(CMAKE_MATCH_2 STREQUAL "M")
+            math(EXPR memory "${memory} * 1024")
+        elseif(CMAKE_MATCH_2 STREQUAL "G")
+            math(EXPR memory "${memory} * 1048576")
+        endif()
+    endif()
+    math(EXPR mean "${total} / ${REPETITIONS}")
+    set("${time_out}" "${mean}" PARENT_SCOPE)
+    set("${memory_out}" "${memory}" PARENT_SCOPE)
+endfunction()
+
+function(pad out text width)
+    string(LENGTH "${text}" length)
+    math(EXPR padding "${width} - ${length}")
+    if(padding LESS "1")
+        set(padding 1)
+    endif()
+    string(REPEAT " " "${padding}" spaces)
+    set("${out}" "${text}${spaces}" PARENT_SCOPE)
+endfunction()
+
+if(NOT BASELINE STREQUAL "")
+    file(STRINGS "${BASELINE}" baseline_lines)
+endif()
+
+file(REMOVE_RECURSE "${BINARY_DIR}")
+file(MAKE_DIRECTORY "${BINARY_DIR}")
+set(csv "configuration,size,time_us,memory_kb\n")
+set(regressions "")
+
+message("Mean front-end time and memory over ${REPETITIONS} runs:\n")
+foreach(configuration IN ITEMS period_pairs arithmetic_chain literal_mix)
+    foreach(size IN LISTS SIZES)
+        set(source "${BINARY_DIR}/${configuration}_${size}.cpp")
+        cmake_language(CALL "write_${configuration}" "${source}" "${size}")
+        measure(time memory "${source}")
+        string(APPEND csv "${configuration},${size},${time},${memory}\n")
+
+        math(EXPR ms "${time} / 1000")
+        pad(label "${configuration} ${size}" 24)
+        pad(time_text "${ms} ms" 12)
+        set(memory_text "")
+        if(NOT memory STREQUAL "")
+            set(memory_text "${memory} kB")
+        endif()
+        message("  ${label}${time_text}${memory_text}")
+
+        # Compare against the matching line of the baseline, if one was given
+        foreach(line IN LISTS baseline_lines)
+            if(line MATCHES "^${configuration},${size},([0-9]*),([0-9]*)$")
+                set(old_time "${CMAKE_MATCH_1}")
+                set(old_memory "${CMAKE_MATCH_2}")
+                math(EXPR time_limit "${old_time} * (100 + ${THRESHOLD}) / 100")
+                if(time GREATER time_limit)
+                    list(APPEND regressions
+                        "${configuration} ${size}: ${old_time} us -> ${time} us")
+                endif()
+                if(NOT old_memory STREQUAL "" AND NOT memory STREQUAL "")
+                    math(EXPR memory_limit "${old_memory} * (100 + ${THRESHOLD}) / 100")
+                    if(memory GREATER memory_limit)
+                        list(APPEND regressions
+                            "${configuration} ${size}: ${old_memory} kB -> ${memory} kB")
+                    endif()
+                endif()
+            endif()
+        endforeach()
+    endforeach()
+endforeach()
+
+file(WRITE "${BINARY_DIR}/results.csv" "${csv}")
+message("\nResults written to ${BINARY_DIR}/results.csv")
+
+if(NOT regressions STREQUAL "")
+    list(JOIN regressions "\n" regression_list)
+    message(FATAL_ERROR
+        "Regressed by more than ${THRESHOLD}% against ${BASELINE}:\n\n${regression_list}\n")
+endif()
@@ -2,6 +2,7 @@ set(FORMAT_PATTERNS
     source/*.cpp source/*.hpp
     include/*.hpp
     test/*.cpp test/*.hpp
+    benchmark/*.cpp benchmark/*.hpp
     CACHE STRING
     "; separated patterns relative to the project source dir to format"
 )
@@ -11,6 +11,7 @@ default(PATTERNS
     source/*.cpp source/*.hpp
     include/*.hpp
     test/*.cpp test/*.hpp
+    benchmark/*.cpp benchmark/*.hpp
 )
 default(FIX NO)
 
@@ -0,0 +1,103 @@
+# Requires CMake 3.23 for microsecond timestamps
+cmake_minimum_required(VERSION 3.23)
+
+macro(default name)
+    if(NOT DEFINED "${name}")
+        set("${name}" "${ARGN}")
+    endif()
+endmacro()
+
+# The module flags default to those of GCC, which writes the compiled module interface to
+# gcm.cache in the working directory and reads it from there when importing
+default(COMPILER c++)
+default(FLAGS -std=c++20 -O0)
+default(MODULE_FLAGS -fmodules-ts)
+default(INCLUDE_DIR "${CMAKE_CURRENT_LIST_DIR}/../include")
+default(MODULE_SOURCE "${CMAKE_CURRENT_LIST_DIR}/../source/frequencypp.cppm")
+default(BINARY_DIR build/module-compile-time)
+default(UNITS 100)
+
+get_filename_component(INCLUDE_DIR "${INCLUDE_DIR}" ABSOLUTE)
+get_filename_component(MODULE_SOURCE "${MODULE_SOURCE}" ABSOLUTE)
+get_filename_component(BINARY_DIR "${BINARY_DIR}" ABSOLUTE)
+
+# Each synthetic translation unit does a little arithmetic on a few frequency types, which varies
+# with the unit so that no two are identical
+function(write_unit path prologue index)
+    math(EXPR a "${index} + 1")
+    math(EXPR b "${index} * 7 + 3")
+    file(WRITE "${path}" "${prologue}
+
+namespace {
+
+using namespace frequencypp::literals;
+
+} // namespace
+
+auto unit_${index}() -> long long
+{
+    const auto f = ${a}_KHz + ${b}_Hz;
+    const auto g = frequencypp::frequency_cast<frequencypp::megahertz>(f * 3);
+    return (f / ${a}).count() + g.count() + (f > ${b}_mHz ? 1 : 0);
+}
+")
+endfunction()
+
+# Compile ${sources} one at a time in ${dir}, storing the total time in microseconds in ${out}
+function(compile_units out dir)
+    set(total 0)
+    foreach(source IN LISTS ARGN)
+        get_filename_component(name "${source}" NAME_WE)
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND "${COMPILER}" ${FLAGS} ${extra_flags} -I "${INCLUDE_DIR}" -c "${source}"
+                -o "${dir}/${name}.o"
+            WORKING_DIRECTORY "${dir}"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE error
+        )
+        string(TIMESTAMP stop "%s%f")
+        if(NOT result EQUAL "0")
+            message(FATAL_ERROR "'${source}': compiler returned with ${result}\n${error}")
+        endif()
+        math(EXPR total "${total} + ${stop} - ${start}")
+    endforeach()
+    set("${out}" "${total}" PARENT_SCOPE)
+endfunction()
+
+function(print_ms label us)
+    math(EXPR ms "${us} / 1000")
+    string(LENGTH "${label}" length)
+    math(EXPR padding "40 - ${length}")
+    string(REPEAT " " "${padding}" pad)
+    message("  ${label}${pad}${ms} ms")
+endfunction()
+
+file(REMOVE_RECURSE "${BINARY_DIR}")
+file(MAKE_DIRECTORY "${BINARY_DIR}/include" "${BINARY_DIR}/import")
+
+math(EXPR last "${UNITS} - 1")
+set(include_units "")
+set(import_units "")
+foreach(i RANGE 0 "${last}")
+    write_unit("${BINARY_DIR}/include/unit_${i}.cpp" "#include <frequencypp/frequency.hpp>" "${i}")
+    write_unit("${BINARY_DIR}/import/unit_${i}.cpp" "import frequencypp;" "${i}")
+    list(APPEND include_units "${BINARY_DIR}/include/unit_${i}.cpp")
+    list(APPEND import_units "${BINARY_DIR}/import/unit_${i}.cpp")
+endforeach()
+
+set(extra_flags "")
+compile_units(include_time "${BINARY_DIR}/include" ${include_units})
+
+# The module interface is compiled once, before the units importing it
+set(extra_flags ${MODULE_FLAGS} -x c++)
+compile_units(interface_time "${BINARY_DIR}/import" "${MODULE_SOURCE}")
+set(extra_flags ${MODULE_FLAGS})
+compile_units(import_time "${BINARY_DIR}/import" ${import_units})
+math(EXPR import_total "${interface_time} + ${import_time}")
+
+message("Sequential compile time of ${UNITS} translation units:\n")
+print_ms("#include <frequencypp/frequency.hpp>" "${include_time}")
+print_ms("import frequencypp;" "${import_total}")
+print_ms("  module interface" "${interface_time}")
+print_ms("  importing units" "${import_time}")
@@ -0,0 +1,278 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the atomic frequency type \ref frequencypp::atomic_frequency
+
+#ifndef FREQUENCYPP_ATOMIC_HPP
+#define FREQUENCYPP_ATOMIC_HPP
+
+#include <atomic>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+/// Frequency of type \p Frequency that can be read and modified atomically from multiple threads
+///
+/// Only the tick count is stored, in a \c std::atomic of the representation, so operations on the
+/// frequency are exactly as cheap as those on the representation.  In particular, the type is
+/// always lock-free for integral representations, and \ref
+/// frequencypp::atomic_frequency::fetch_add and \ref frequencypp::atomic_frequency::fetch_sub are
+/// single atomic instructions for them.  Other representations are updated in a
+/// compare-and-exchange loop.
+///
+/// The operations take frequencies of type \p Frequency, so that arguments of another period are
+/// converted implicitly where the converting constructor of \ref frequencypp::frequency allows,
+/// such as from kilohertz to hertz.
+///
+/// \tparam Frequency \ref frequencypp::frequency type of the value
+template<typename Frequency>
+class atomic_frequency
+{
+    static_assert(detail::is_frequency_v<Frequency>, "Frequency must be a frequency");
+    static_assert(std::is_trivially_copyable_v<typename Frequency::rep>,
+        "Frequency must have a trivially copyable representation");
+    static_assert(!std::is_integral_v<typename Frequency::rep>
+            || std::atomic<typename Frequency::rep>::is_always_lock_free,
+        "Frequency must have a lock-free representation if it is integral");
+
+    using rep = typename Frequency::rep;
+
+    std::atomic<rep> count_;
+
+    template<typename Op>
+    auto fetch_update(Op op, std::memory_order order) noexcept -> Frequency
+    {
+        auto expected = count_.load(std::memory_order_relaxed);
+        while (!count_.compare_exchange_weak(
+            expected, op(Frequency{expected}).count(), order, std::memory_order_relaxed))
+        {}
+        return Frequency{expected};
+    }
+
+public:
+    /// \ref frequencypp::frequency type of the value
+    using value_type = Frequency;
+
+    /// Whether the value is always lock-free
+    static constexpr bool is_always_lock_free = std::atomic<rep>::is_always_lock_free;
+
+    /// Construct the value as a zero frequency
+    atomic_frequency() noexcept
+        : count_(Frequency::zero().count())
+    {}
+
+    /// Construct the value as frequency \p f
+    ///
+    /// \param f initial frequency
+    constexpr atomic_frequency(Frequency f) noexcept
+        : count_(f.count())
+    {}
+
+    atomic_frequency(const atomic_frequency&) = delete;
+    auto operator=(const atomic_frequency&) -> atomic_frequency& = delete;
+    auto operator=(const atomic_frequency&) volatile -> atomic_frequency& = delete;
+
+    /// Store frequency \p f, as if by \ref frequencypp::atomic_frequency::store
+    ///
+    /// \param f frequency to store
+    /// \return \p f
+    auto operator=(Frequency f) noexcept -> Frequency
+    {
+        store(f);
+        return f;
+    }
+
+    /// Load the frequency, as if by \ref frequencypp::atomic_frequency::load
+    operator Frequency() const noexcept
+    {
+        return load();
+    }
+
+    /// Determine whether operations on the value are lock-free
+    ///
+    /// \retval true if operations on the value are lock-free
+    /// \retval false if operations on the value may use a lock
+    [[nodiscard]] auto is_lock_free() const noexcept -> bool
+    {
+        return count_.is_lock_free();
+    }
+
+    /// Replace the frequency with \p f
+    ///
+    /// \param f frequency to store
+    /// \param order memory ordering of the operation
+    void store(Frequency f, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        count_.store(f.count(), order);
+    }
+
+    /// Get the frequency
+    ///
+    /// \param order memory ordering of the operation
+    /// \return current frequency
+    [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        -> Frequency
+    {
+        return Frequency{count_.load(order)};
+    }
+
+    /// Replace the frequency with \p f
+    ///
+    /// \param f frequency to store
+    /// \param order memory ordering of the operation
+    /// \return frequency before the operation
+    auto exchange(Frequency f, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> Frequency
+    {
+        return Frequency{count_.exchange(f.count(), order)};
+    }
+
+    /// Replace the frequency with \p desired if it equals \p expected, and otherwise load it into
+    /// \p expected, which may fail spuriously
+    ///
+    /// \param expected frequency expected to be stored, which receives the current frequency on
+    /// failure
+    /// \param desired frequency to store
+    /// \param success memory ordering of the operation if the frequencies are equal
+    /// \param failure memory ordering of the operation if the frequencies differ
+    /// \retval true if the frequency was replaced
+    /// \retval false if the frequency was loaded into \p expected
+    auto compare_exchange_weak(Frequency& expected,
+        Frequency desired,
+        std::memory_order success,
+        std::memory_order failure) noexcept -> bool
+    {
+        auto count = expected.count();
+        const auto exchanged =
+            count_.compare_exchange_weak(count, desired.count(), success, failure);
+        expected = Frequency{count};
+        return exchanged;
+    }
+
+    /// \copybrief compare_exchange_weak
+    ///
+    /// \param expected frequency expected to be stored, which receives the current frequency on
+    /// failure
+    /// \param desired frequency to store
+    /// \param order memory ordering of the operation
+    /// \retval true if the frequency was replaced
+    /// \retval false if the frequency was loaded into \p expected
+    auto compare_exchange_weak(Frequency& expected,
+        Frequency desired,
+        std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        auto count = expected.count();
+        const auto exchanged = count_.compare_exchange_weak(count, desired.count(), order);
+        expected = Frequency{count};
+        return exchanged;
+    }
+
+    /// Replace the frequency with \p desired if it equals \p expected, and otherwise load it into
+    /// \p expected
+    ///
+    /// \param expected frequency expected to be stored, which receives the current frequency on
+    /// failure
+    /// \param desired frequency to store
+    /// \param success memory ordering of the operation if the frequencies are equal
+    /// \param failure memory ordering of the operation if the frequencies differ
+    /// \retval true if the frequency was replaced
+    /// \retval false if the frequency was loaded into \p expected
+    auto compare_exchange_strong(Frequency& expected,
+        Frequency desired,
+        std::memory_order success,
+        std::memory_order failure) noexcept -> bool
+    {
+        auto count = expected.count();
+        const auto exchanged =
+            count_.compare_exchange_strong(count, desired.count(), success, failure);
+        expected = Frequency{count};
+        return exchanged;
+    }
+
+    /// \copybrief compare_exchange_strong
+    ///
+    /// \param expected frequency expected to be stored, which receives the current frequency on
+    /// failure
+    /// \param desired frequency to store
+    /// \param order memory ordering of the operation
+    /// \retval true if the frequency was replaced
+    /// \retval false if the frequency was loaded into \p expected
+    auto compare_exchange_strong(Frequency& expected,
+        Frequency desired,
+        std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        auto count = expected.count();
+        const auto exchanged = count_.compare_exchange_strong(count, desired.count(), order);
+        expected = Frequency{count};
+        return exchanged;
+    }
+
+    /// Add frequency \p f to the frequency
+    ///
+    /// \param f frequency to add
+    /// \param order memory ordering of the operation
+    /// \return frequency before the operation
+    auto fetch_add(Frequency f, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> Frequency
+    {
+        if constexpr (std::is_integral_v<rep>) {
+            return Frequency{count_.fetch_add(f.count(), order)};
+        }
+        else {
+            return fetch_update([f](Frequency current) { return current + f; }, order);
+        }
+    }
+
+    /// Subtract frequency \p f from the frequency
+    ///
+    /// \param f frequency to subtract
+    /// \param order memory ordering of the operation
+    /// \return frequency before the operation
+    auto fetch_sub(Frequency f, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> Frequency
+    {
+        if constexpr (std::is_integral_v<rep>) {
+            return Frequency{count_.fetch_sub(f.count(), order)};
+        }
+        else {
+            return fetch_update([f](Frequency current) { return current - f; }, order);
+        }
+    }
+
+    /// Add frequency \p f to the frequency, as if by \ref frequencypp::atomic_frequency::fetch_add
+    ///
+    /// \param f frequency to add
+    /// \return frequency after the operation
+    auto operator+=(Frequency f) noexcept -> Frequency
+    {
+        return fetch_add(f) + f;
+    }
+
+    /// Subtract frequency \p f from the frequency, as if by \ref
+    /// frequencypp::atomic_frequency::fetch_sub
+    ///
+    /// \param f frequency to subtract
+    /// \return frequency after the operation
+    auto operator-=(Frequency f) noexcept -> Frequency
+    {
+        return fetch_sub(f) - f;
+    }
+};
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_ATOMIC_HPP
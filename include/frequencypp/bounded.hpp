@@ -0,0 +1,715 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the range-bounded integer representation \ref frequencypp::bounded and its associated
+/// specializations
+
+#ifndef FREQUENCYPP_BOUNDED_HPP
+#define FREQUENCYPP_BOUNDED_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <frequencypp/detail/attributes.hpp>
+#include <frequencypp/detail/overflow.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+template<typename Int, Int Lo, Int Hi>
+class bounded;
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+/// Closed range of values, and whether computing it overflowed \c std::intmax_t
+struct bound_range
+{
+    std::intmax_t lo;
+    std::intmax_t hi;
+    bool valid;
+};
+
+constexpr auto min_of(std::intmax_t a) noexcept -> std::intmax_t
+{
+    return a;
+}
+
+template<typename... Ts>
+constexpr auto min_of(std::intmax_t a, Ts... rest) noexcept -> std::intmax_t
+{
+    const auto b = min_of(rest...);
+    return a < b ? a : b;
+}
+
+constexpr auto max_of(std::intmax_t a) noexcept -> std::intmax_t
+{
+    return a;
+}
+
+template<typename... Ts>
+constexpr auto max_of(std::intmax_t a, Ts... rest) noexcept -> std::intmax_t
+{
+    const auto b = max_of(rest...);
+    return a > b ? a : b;
+}
+
+constexpr auto add_range(bound_range a, bound_range b) noexcept -> bound_range
+{
+    auto r = bound_range{0, 0, a.valid && b.valid};
+    r.valid &= !add_overflow(a.lo, b.lo, r.lo);
+    r.valid &= !add_overflow(a.hi, b.hi, r.hi);
+    return r;
+}
+
+constexpr auto sub_range(bound_range a, bound_range b) noexcept -> bound_range
+{
+    auto r = bound_range{0, 0, a.valid && b.valid};
+    r.valid &= !sub_overflow(a.lo, b.hi, r.lo);
+    r.valid &= !sub_overflow(a.hi, b.lo, r.hi);
+    return r;
+}
+
+constexpr auto mul_range(bound_range a, bound_range b) noexcept -> bound_range
+{
+    std::intmax_t c[4] = {};
+    auto valid = a.valid && b.valid;
+    valid &= !mul_overflow(a.lo, b.lo, c[0]);
+    valid &= !mul_overflow(a.lo, b.hi, c[1]);
+    valid &= !mul_overflow(a.hi, b.lo, c[2]);
+    valid &= !mul_overflow(a.hi, b.hi, c[3]);
+    return {min_of(c[0], c[1], c[2], c[3]), max_of(c[0], c[1], c[2], c[3]), valid};
+}
+
+// Truncating division is monotonic in each operand while the divisor keeps its sign, so the
+// quotient is extreme at the corners of the ranges
+constexpr auto div_range(bound_range a, bound_range b) noexcept -> bound_range
+{
+    constexpr auto min = std::numeric_limits<std::intmax_t>::min();
+    const auto valid = a.valid && b.valid && (b.lo > 0 || b.hi < 0) && !(a.lo == min && b.hi == -1);
+    if (!valid) {
+        return {0, 0, false};
+    }
+    const auto q0 = a.lo / b.lo;
+    const auto q1 = a.lo / b.hi;
+    const auto q2 = a.hi / b.lo;
+    const auto q3 = a.hi / b.hi;
+    return {min_of(q0, q1, q2, q3), max_of(q0, q1, q2, q3), true};
+}
+
+// The remainder takes the sign of the dividend and is smaller in magnitude than the divisor
+constexpr auto mod_range(bound_range a, bound_range b) noexcept -> bound_range
+{
+    constexpr auto min = std::numeric_limits<std::intmax_t>::min();
+    const auto valid = a.valid && b.valid && (b.lo > 0 || b.hi < 0) && b.lo != min;
+    if (!valid) {
+        return {0, 0, false};
+    }
+    const auto m = max_of(b.lo < 0 ? -b.lo : b.lo, b.hi < 0 ? -b.hi : b.hi) - 1;
+    return {a.lo < 0 ? max_of(a.lo, -m) : 0, a.hi > 0 ? min_of(a.hi, m) : 0, true};
+}
+
+constexpr auto neg_range(bound_range a) noexcept -> bound_range
+{
+    constexpr auto min = std::numeric_limits<std::intmax_t>::min();
+    return {a.hi == min ? 0 : -a.hi, a.lo == min ? 0 : -a.lo, a.valid && a.lo != min};
+}
+
+template<typename Int>
+constexpr auto fits_range(std::intmax_t lo, std::intmax_t hi) noexcept -> bool
+{
+    return lo >= std::numeric_limits<Int>::lowest() && hi <= std::numeric_limits<Int>::max();
+}
+
+/// Narrowest signed integral type holding every value in [\p Lo, \p Hi]
+template<std::intmax_t Lo, std::intmax_t Hi>
+using narrowest_int_t = std::conditional_t<fits_range<std::int8_t>(Lo, Hi),
+    std::int8_t,
+    std::conditional_t<fits_range<std::int16_t>(Lo, Hi),
+        std::int16_t,
+        std::conditional_t<fits_range<std::int32_t>(Lo, Hi), std::int32_t, std::intmax_t>>>;
+
+/// \p Int if it holds every value in [\p Lo, \p Hi], otherwise the narrowest type that does
+template<typename Int, std::intmax_t Lo, std::intmax_t Hi>
+using fit_int_t = std::conditional_t<fits_range<Int>(Lo, Hi), Int, narrowest_int_t<Lo, Hi>>;
+
+/// Type that arithmetic on values in [\p Lo, \p Hi] is computed in, after integral promotion
+template<std::intmax_t Lo, std::intmax_t Hi>
+using compute_int_t = std::common_type_t<narrowest_int_t<Lo, Hi>, int>;
+
+/// Bounded type for [\p Lo, \p Hi], stored as \p Int if it holds the range
+template<typename Int, std::intmax_t Lo, std::intmax_t Hi>
+using bounded_for_t = bounded<fit_int_t<Int, Lo, Hi>,
+    static_cast<fit_int_t<Int, Lo, Hi>>(Lo),
+    static_cast<fit_int_t<Int, Lo, Hi>>(Hi)>;
+
+template<typename T>
+struct is_bounded : std::false_type
+{};
+
+template<typename Int, Int Lo, Int Hi>
+struct is_bounded<bounded<Int, Lo, Hi>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_bounded_v = is_bounded<T>::value;
+
+/// Result type of an operation on values in [\p L1, \p H1] and [\p L2, \p H2] stored as \p I1 and
+/// \p I2, whose result lies in [\p Lo, \p Hi], and the type that the operation is computed in
+template<typename I1,
+    std::intmax_t L1,
+    std::intmax_t H1,
+    typename I2,
+    std::intmax_t L2,
+    std::intmax_t H2,
+    std::intmax_t Lo,
+    std::intmax_t Hi>
+struct bounded_operation
+{
+    using result = bounded_for_t<std::common_type_t<I1, I2>, Lo, Hi>;
+    using value_type = typename result::value_type;
+    using compute = compute_int_t<min_of(L1, L2, Lo), max_of(H1, H2, Hi)>;
+};
+
+/// Called when a value outside its bounds is stored, which makes the store ill-formed in a
+/// constant expression and does nothing otherwise
+FREQUENCYPP_INLINE inline void bounds_violated() noexcept {}
+
+/// Range of the tick counts of frequencies in [\p Lo, \p Hi] ticks of \p Period when converted to
+/// ticks of \p ToPeriod, and the type the conversion is computed in
+template<std::intmax_t Lo, std::intmax_t Hi, typename Period, typename ToPeriod>
+struct scaled_range
+{
+    using scale = scale_ratio<std::intmax_t, Period, std::ratio<ToPeriod::den, ToPeriod::num>>;
+    static constexpr auto num = scale::num;
+    static constexpr auto den = scale::den;
+    static constexpr auto product = mul_range({Lo, Hi, true}, {num, num, true});
+    static constexpr auto range = bound_range{product.lo / den, product.hi / den, product.valid};
+    using compute_type =
+        compute_int_t<min_of(Lo, product.lo), max_of(Hi, product.hi, num, den)>;
+};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Integer representation whose range of values is known at compile time
+///
+/// The bounds of the results of arithmetic on bounded values are derived from the bounds of the
+/// operands, and so are the bounds of the tick counts produced by \ref frequencypp::frequency_cast
+/// and by the common type of two bounded frequencies.  Since the bounds of every intermediate are
+/// known, the conversion is computed in the narrowest integer type that cannot overflow, such as
+/// 32 bits for frequencies below 2GHz converted to kilohertz, rather than in \c std::intmax_t.
+/// Comparisons between values whose ranges do not overlap are decided at compile time, and
+/// conversions to \ref frequencypp::checked or \ref frequencypp::saturating representations that
+/// are wide enough for the bounds need no check.  Operations whose bounds cannot be proven, such as
+/// a conversion to a bounded type too narrow for the result or division by a range that includes
+/// zero, do not compile.
+///
+/// The bounds are a promise made when a value is stored, which is not checked at runtime.  Storing
+/// a value outside the bounds is ill-formed in a constant expression and undefined otherwise.  As
+/// the result of \c += would need wider bounds than its left-hand side, bounded values provide no
+/// compound assignment; arithmetic produces values of new types instead.  Mixing bounded and
+/// unbounded integers yields unbounded results through \c std::common_type.
+///
+/// \tparam Int signed integral type storing the value
+/// \tparam Lo smallest value
+/// \tparam Hi largest value
+template<typename Int, Int Lo, Int Hi>
+class bounded
+{
+    static_assert(detail::is_overflow_int_v<Int> && std::is_signed_v<Int>,
+        "Int must be a signed integral type");
+    static_assert(Lo <= Hi, "Lo must not exceed Hi");
+
+    Int value_;
+
+public:
+    /// Integral type storing the value
+    using value_type = Int;
+
+    /// Smallest value
+    static constexpr Int lower = Lo;
+    /// Largest value
+    static constexpr Int upper = Hi;
+
+    /// Default-construct the value
+    bounded() = default;
+
+    /// Construct the value from integer \p v, which must lie within the bounds
+    ///
+    /// \tparam T integral type of the value
+    /// \param v value to store
+    template<typename T, typename = std::enable_if_t<detail::is_overflow_int_v<T>>>
+    // Implicit conversions are desired for this constructor, as they enable construction like
+    // frequency<bounded<int, 0, 100>>{5}
+    // NOLINTNEXTLINE
+    FREQUENCYPP_INLINE constexpr bounded(T v) noexcept
+        : value_(static_cast<Int>(v))
+    {
+        if (detail::cmp_less(v, Lo) || detail::cmp_less(Hi, v)) {
+            detail::bounds_violated();
+        }
+    }
+
+    /// Construct the value from a bounded value \p v whose bounds lie within these
+    ///
+    /// \tparam T integral type storing the value of \p v
+    /// \tparam L smallest value of \p v
+    /// \tparam H largest value of \p v
+    /// \param v value to store
+    template<typename T, T L, T H, typename = std::enable_if_t<(L >= Lo && H <= Hi)>>
+    // Implicit conversions are desired for this constructor, as the bounds prove them safe
+    // NOLINTNEXTLINE
+    FREQUENCYPP_INLINE constexpr bounded(bounded<T, L, H> v) noexcept
+        : value_(static_cast<Int>(v.value()))
+    {}
+
+    /// Get the stored value
+    ///
+    /// \return stored value
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto value() const noexcept -> Int
+    {
+        return value_;
+    }
+
+    /// Convert the value to arithmetic type \p T, as if by \c static_cast
+    ///
+    /// \tparam T arithmetic type to convert to
+    template<typename T,
+        typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    FREQUENCYPP_INLINE constexpr explicit operator T() const noexcept
+    {
+        return static_cast<T>(value_);
+    }
+
+    /// Determine whether the value is nonzero
+    FREQUENCYPP_INLINE constexpr explicit operator bool() const noexcept
+    {
+        return value_ != 0;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator+(bounded v) noexcept -> bounded
+    {
+        return v;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator-(bounded v) noexcept
+    {
+        constexpr auto r = detail::neg_range({Lo, Hi, true});
+        static_assert(r.valid, "the bounds of the negation exceed std::intmax_t");
+        using result = detail::bounded_for_t<Int, r.lo, r.hi>;
+        using compute = detail::compute_int_t<detail::min_of(Lo, r.lo), detail::max_of(Hi, r.hi)>;
+        return result{static_cast<typename result::value_type>(-static_cast<compute>(v.value_))};
+    }
+
+    /// Inserts the stored value of \p v into \p os
+    template<typename CharT, typename Traits>
+    friend auto operator<<(std::basic_ostream<CharT, Traits>& os, bounded v)
+        -> std::basic_ostream<CharT, Traits>&
+    {
+        // Promote narrow types so that int8_t is not inserted as a character
+        return os << +v.value_;
+    }
+};
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator+(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept
+{
+    constexpr auto r = detail::add_range({L1, H1, true}, {L2, H2, true});
+    static_assert(r.valid, "the bounds of the sum exceed std::intmax_t");
+    using op = detail::bounded_operation<I1, L1, H1, I2, L2, H2, r.lo, r.hi>;
+    using compute = typename op::compute;
+    return typename op::result{static_cast<typename op::value_type>(
+        static_cast<compute>(lhs.value()) + static_cast<compute>(rhs.value()))};
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator-(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept
+{
+    constexpr auto r = detail::sub_range({L1, H1, true}, {L2, H2, true});
+    static_assert(r.valid, "the bounds of the difference exceed std::intmax_t");
+    using op = detail::bounded_operation<I1, L1, H1, I2, L2, H2, r.lo, r.hi>;
+    using compute = typename op::compute;
+    return typename op::result{static_cast<typename op::value_type>(
+        static_cast<compute>(lhs.value()) - static_cast<compute>(rhs.value()))};
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator*(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept
+{
+    constexpr auto r = detail::mul_range({L1, H1, true}, {L2, H2, true});
+    static_assert(r.valid, "the bounds of the product exceed std::intmax_t");
+    using op = detail::bounded_operation<I1, L1, H1, I2, L2, H2, r.lo, r.hi>;
+    using compute = typename op::compute;
+    return typename op::result{static_cast<typename op::value_type>(
+        static_cast<compute>(lhs.value()) * static_cast<compute>(rhs.value()))};
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator/(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept
+{
+    constexpr auto r = detail::div_range({L1, H1, true}, {L2, H2, true});
+    static_assert(r.valid,
+        "the divisor range must exclude zero and the quotient bounds must fit in std::intmax_t");
+    using op = detail::bounded_operation<I1, L1, H1, I2, L2, H2, r.lo, r.hi>;
+    using compute = typename op::compute;
+    return typename op::result{static_cast<typename op::value_type>(
+        static_cast<compute>(lhs.value()) / static_cast<compute>(rhs.value()))};
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator%(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept
+{
+    constexpr auto r = detail::mod_range({L1, H1, true}, {L2, H2, true});
+    static_assert(r.valid,
+        "the divisor range must exclude zero and the remainder bounds must fit in std::intmax_t");
+    using op = detail::bounded_operation<I1, L1, H1, I2, L2, H2, r.lo, r.hi>;
+    using compute = typename op::compute;
+    return typename op::result{static_cast<typename op::value_type>(
+        static_cast<compute>(lhs.value()) % static_cast<compute>(rhs.value()))};
+}
+
+// Comparisons between ranges that do not overlap are decided by the bounds alone
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator==(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    if constexpr (H1 < L2 || H2 < L1) {
+        static_cast<void>(lhs);
+        static_cast<void>(rhs);
+        return false;
+    }
+    else {
+        return lhs.value() == rhs.value();
+    }
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator!=(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator<(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    if constexpr (H1 < L2 || L1 >= H2) {
+        static_cast<void>(lhs);
+        static_cast<void>(rhs);
+        return H1 < L2;
+    }
+    else {
+        return lhs.value() < rhs.value();
+    }
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator>(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    return rhs < lhs;
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator<=(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    return !(rhs < lhs);
+}
+
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator>=(
+    bounded<I1, L1, H1> lhs, bounded<I2, L2, H2> rhs) noexcept -> bool
+{
+    return !(lhs < rhs);
+}
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename Int, typename U, typename = void>
+struct bounded_common_type
+{};
+
+template<typename Int, typename U>
+struct bounded_common_type<Int, U, std::enable_if_t<is_overflow_int_v<U>>>
+{
+    using type = std::common_type_t<Int, U>;
+};
+
+/// Bounded types of the tick counts of frequencies in [\p L1, \p H1] ticks of \p P1 and [\p L2,
+/// \p H2] ticks of \p P2 converted to their common period, and of their common type, which is the
+/// hull of both ranges in that period
+template<typename I1,
+    std::intmax_t L1,
+    std::intmax_t H1,
+    typename P1,
+    typename I2,
+    std::intmax_t L2,
+    std::intmax_t H2,
+    typename P2>
+struct bounded_common_frequency
+{
+    using period = typename std::common_type_t<frequency<I1, P1>, frequency<I2, P2>>::period;
+    using range1 = scaled_range<L1, H1, P1, period>;
+    using range2 = scaled_range<L2, H2, P2, period>;
+    static_assert(range1::range.valid && range2::range.valid,
+        "the bounds in the common period exceed std::intmax_t");
+    using rep1 = bounded_for_t<I1, range1::range.lo, range1::range.hi>;
+    using rep2 = bounded_for_t<I2, range2::range.lo, range2::range.hi>;
+    using rep = bounded_for_t<std::common_type_t<I1, I2>,
+        min_of(range1::range.lo, range2::range.lo),
+        max_of(range1::range.hi, range2::range.hi)>;
+};
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::common_type for two \ref frequencypp::bounded types
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2>
+struct std::common_type<frequencypp::bounded<I1, L1, H1>, frequencypp::bounded<I2, L2, H2>>
+{
+    /// Bounded type over the hull of both ranges
+    using type = frequencypp::detail::bounded_for_t<std::common_type_t<I1, I2>,
+        frequencypp::detail::min_of(L1, L2),
+        frequencypp::detail::max_of(H1, H2)>;
+};
+
+/// Specialization of std::common_type for a \ref frequencypp::bounded type and an integral type,
+/// which is unbounded
+template<typename Int, Int Lo, Int Hi, typename U>
+struct std::common_type<frequencypp::bounded<Int, Lo, Hi>, U>
+    : frequencypp::detail::bounded_common_type<Int, U>
+{};
+
+/// Specialization of std::common_type for an integral type and a \ref frequencypp::bounded type,
+/// which is unbounded
+template<typename U, typename Int, Int Lo, Int Hi>
+struct std::common_type<U, frequencypp::bounded<Int, Lo, Hi>>
+    : frequencypp::detail::bounded_common_type<Int, U>
+{};
+
+/// Specialization of std::common_type for two \ref frequencypp::frequency types with \ref
+/// frequencypp::bounded representations, whose bounds are those of both operands converted to the
+/// common period
+template<typename I1, I1 L1, I1 H1, typename P1, typename I2, I2 L2, I2 H2, typename P2>
+struct std::common_type<frequencypp::frequency<frequencypp::bounded<I1, L1, H1>, P1>,
+    frequencypp::frequency<frequencypp::bounded<I2, L2, H2>, P2>>
+{
+private:
+    using common = frequencypp::detail::bounded_common_frequency<I1, L1, H1, P1, I2, L2, H2, P2>;
+
+public:
+    /// Common type of the two frequency types
+    using type = frequencypp::frequency<typename common::rep, typename common::period>;
+};
+
+/// Specialization of std::numeric_limits for \ref frequencypp::bounded, whose limits are its bounds
+template<typename Int, Int Lo, Int Hi>
+class std::numeric_limits<frequencypp::bounded<Int, Lo, Hi>> : public std::numeric_limits<Int>
+{
+public:
+    static constexpr auto min() noexcept -> frequencypp::bounded<Int, Lo, Hi>
+    {
+        return Lo;
+    }
+
+    static constexpr auto lowest() noexcept -> frequencypp::bounded<Int, Lo, Hi>
+    {
+        return Lo;
+    }
+
+    static constexpr auto max() noexcept -> frequencypp::bounded<Int, Lo, Hi>
+    {
+        return Hi;
+    }
+};
+
+namespace frequencypp {
+
+/// Specialization of \ref frequencypp::frequency_values for \ref frequencypp::bounded, whose
+/// extremes are its bounds
+///
+/// \tparam Int signed integral type storing the value
+/// \tparam Lo smallest value
+/// \tparam Hi largest value
+template<typename Int, Int Lo, Int Hi>
+struct frequency_values<bounded<Int, Lo, Hi>>
+{
+    static_assert(Lo <= 0 && Hi >= 0, "the bounds must include zero to provide a zero value");
+
+    /// Gets the zero-length representation
+    ///
+    /// \return zero-length representation
+    FREQUENCYPP_INLINE static constexpr auto zero() noexcept -> bounded<Int, Lo, Hi>
+    {
+        return Int{0};
+    }
+
+    /// Gets the smallest possible representation
+    ///
+    /// \return smallest possible representation
+    FREQUENCYPP_INLINE static constexpr auto min() noexcept -> bounded<Int, Lo, Hi>
+    {
+        return Lo;
+    }
+
+    /// Gets the largest possible representation
+    ///
+    /// \return largest possible representation
+    FREQUENCYPP_INLINE static constexpr auto max() noexcept -> bounded<Int, Lo, Hi>
+    {
+        return Hi;
+    }
+};
+
+/// Convert a \ref frequencypp::frequency with a \ref frequencypp::bounded representation to a
+/// frequency of different type \p ToFrequency
+///
+/// The bounds of \p f determine the bounds of the scaled tick count, so the computation is done in
+/// the narrowest integral type that cannot overflow rather than in \c std::intmax_t, and the result
+/// is narrowed to the smallest type holding those bounds before it is converted to the result type.
+/// Conversions to bounded representations must be wide enough for the scaled bounds.  Conversions
+/// to floating-point representations are done as for the stored integral type.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Int signed integral type storing the tick count of \p f
+/// \tparam Lo smallest tick count of \p f
+/// \tparam Hi largest tick count of \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return \p f converted to a frequency of type \p ToFrequency
+template<typename ToFrequency, typename Int, Int Lo, Int Hi, typename Period>
+FREQUENCYPP_INLINE constexpr auto frequency_cast(const frequency<bounded<Int, Lo, Hi>, Period>& f)
+    -> std::enable_if_t<detail::is_frequency_v<ToFrequency>, ToFrequency>
+{
+    using to_rep = typename ToFrequency::rep;
+    using to_period = typename ToFrequency::period;
+    if constexpr (std::chrono::treat_as_floating_point_v<to_rep>) {
+        return frequency_cast<ToFrequency>(frequency<Int, Period>{f.count().value()});
+    }
+    else {
+        using scaled = detail::scaled_range<Lo, Hi, Period, to_period>;
+        constexpr auto r = scaled::range;
+        static_assert(r.valid, "the bounds of the converted tick count exceed std::intmax_t");
+        using compute = typename scaled::compute_type;
+        using narrow = detail::narrowest_int_t<r.lo, r.hi>;
+        const auto count = static_cast<narrow>(static_cast<compute>(f.count().value())
+            * static_cast<compute>(scaled::num) / static_cast<compute>(scaled::den));
+        if constexpr (detail::is_bounded_v<to_rep>) {
+            static_assert(r.lo >= to_rep::lower && r.hi <= to_rep::upper,
+                "the bounds of the converted tick count exceed those of the representation");
+            return ToFrequency{detail::bounded_for_t<narrow, r.lo, r.hi>{count}};
+        }
+        else {
+            return ToFrequency{static_cast<to_rep>(count)};
+        }
+    }
+}
+
+/// Add the tick counts of frequencies \p lhs and \p rhs with \ref frequencypp::bounded
+/// representations
+///
+/// The calculation is done in the common period of \p lhs and \p rhs, and the bounds of the
+/// result are the sum of their bounds in that period.
+///
+/// \param lhs left-hand frequency to add
+/// \param rhs right-hand frequency to add
+/// \return frequency with the sum of the tick counts of \p lhs and \p rhs
+template<typename I1, I1 L1, I1 H1, typename P1, typename I2, I2 L2, I2 H2, typename P2>
+FREQUENCYPP_INLINE constexpr auto operator+(const frequency<bounded<I1, L1, H1>, P1>& lhs,
+    const frequency<bounded<I2, L2, H2>, P2>& rhs)
+{
+    using common = detail::bounded_common_frequency<I1, L1, H1, P1, I2, L2, H2, P2>;
+    using period = typename common::period;
+    const auto a = frequency_cast<frequency<typename common::rep1, period>>(lhs).count();
+    const auto b = frequency_cast<frequency<typename common::rep2, period>>(rhs).count();
+    return frequency<decltype(a + b), period>{a + b};
+}
+
+/// Subtract the tick count of frequency \p rhs from the tick count of frequency \p lhs, both with
+/// \ref frequencypp::bounded representations
+///
+/// The calculation is done in the common period of \p lhs and \p rhs, and the bounds of the
+/// result are the difference of their bounds in that period.
+///
+/// \param lhs left-hand frequency to subtract
+/// \param rhs right-hand frequency to subtract
+/// \return frequency with the difference of the tick counts of \p lhs and \p rhs
+template<typename I1, I1 L1, I1 H1, typename P1, typename I2, I2 L2, I2 H2, typename P2>
+FREQUENCYPP_INLINE constexpr auto operator-(const frequency<bounded<I1, L1, H1>, P1>& lhs,
+    const frequency<bounded<I2, L2, H2>, P2>& rhs)
+{
+    using common = detail::bounded_common_frequency<I1, L1, H1, P1, I2, L2, H2, P2>;
+    using period = typename common::period;
+    const auto a = frequency_cast<frequency<typename common::rep1, period>>(lhs).count();
+    const auto b = frequency_cast<frequency<typename common::rep2, period>>(rhs).count();
+    return frequency<decltype(a - b), period>{a - b};
+}
+
+/// Multiply the tick count of frequency \p lhs by factor \p rhs, both \ref frequencypp::bounded
+///
+/// \param lhs left-hand frequency to multiply
+/// \param rhs right-hand factor to multiply by
+/// \return frequency with the product of the tick count of \p lhs and \p rhs
+template<typename I1, I1 L1, I1 H1, typename Period, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator*(
+    const frequency<bounded<I1, L1, H1>, Period>& lhs, bounded<I2, L2, H2> rhs)
+{
+    return frequency<decltype(lhs.count() * rhs), Period>{lhs.count() * rhs};
+}
+
+/// Multiply the tick count of frequency \p rhs by factor \p lhs, both \ref frequencypp::bounded
+///
+/// \param lhs left-hand factor to multiply by
+/// \param rhs right-hand frequency to multiply
+/// \return frequency with the product of \p lhs and the tick count of \p rhs
+template<typename I1, I1 L1, I1 H1, typename I2, I2 L2, I2 H2, typename Period>
+FREQUENCYPP_INLINE constexpr auto operator*(
+    bounded<I1, L1, H1> lhs, const frequency<bounded<I2, L2, H2>, Period>& rhs)
+{
+    return frequency<decltype(lhs * rhs.count()), Period>{lhs * rhs.count()};
+}
+
+/// Divide the tick count of frequency \p lhs by factor \p rhs, both \ref frequencypp::bounded,
+/// where the bounds of \p rhs must exclude zero
+///
+/// \param lhs left-hand frequency to divide
+/// \param rhs right-hand factor to divide by
+/// \return frequency with the quotient of the tick count of \p lhs and \p rhs
+template<typename I1, I1 L1, I1 H1, typename Period, typename I2, I2 L2, I2 H2>
+FREQUENCYPP_INLINE constexpr auto operator/(
+    const frequency<bounded<I1, L1, H1>, Period>& lhs, bounded<I2, L2, H2> rhs)
+{
+    return frequency<decltype(lhs.count() / rhs), Period>{lhs.count() / rhs};
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_BOUNDED_HPP
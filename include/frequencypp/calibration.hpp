@@ -0,0 +1,266 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains functions measuring the frequency of a hardware counter, and of the x86 time-stamp
+/// counter in particular
+
+#ifndef FREQUENCYPP_CALIBRATION_HPP
+#define FREQUENCYPP_CALIBRATION_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+
+#include <frequencypp/frequency_core.hpp>
+#include <frequencypp/tick_clock.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FREQUENCYPP_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define FREQUENCYPP_HAS_TSC 0
+#endif
+
+namespace frequencypp {
+
+/// Limits on the adaptive calibration performed by \ref frequencypp::calibrate_frequency
+struct calibration_options
+{
+    /// Largest acceptable relative error of the measured frequency
+    double tolerance = 100e-6;
+    /// Shortest time to measure for, regardless of the error bound
+    std::chrono::nanoseconds min_duration = std::chrono::microseconds{500};
+    /// Longest time to measure for, after which the measurement is returned as it stands
+    std::chrono::nanoseconds max_duration = std::chrono::milliseconds{50};
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+/// Counter reading bracketed by two clock readings, which bound when the counter was read
+template<typename Clock>
+struct calibration_sample
+{
+    std::uint64_t ticks;
+    typename Clock::time_point before;
+    typename Clock::time_point after;
+
+    [[nodiscard]] auto midpoint() const -> typename Clock::time_point
+    {
+        return before + (after - before) / 2;
+    }
+
+    [[nodiscard]] auto uncertainty() const -> typename Clock::duration
+    {
+        return (after - before) / 2;
+    }
+};
+
+template<typename Counter, typename Clock>
+auto take_calibration_sample() -> calibration_sample<Clock>
+{
+    // Keep the tightest of a few brackets, discarding those stretched by preemption or interrupts
+    auto best = calibration_sample<Clock>{};
+    for (auto attempt = 0; attempt < 4; ++attempt) {
+        const auto before = Clock::now();
+        const auto ticks = static_cast<std::uint64_t>(Counter::read());
+        const auto after = Clock::now();
+        if (attempt == 0 || after - before < best.after - best.before) {
+            best = {ticks, before, after};
+        }
+    }
+    return best;
+}
+
+#if FREQUENCYPP_HAS_TSC
+
+inline auto cpuid(std::uint32_t leaf, std::uint32_t (&regs)[4]) noexcept -> void
+{
+#if defined(_MSC_VER)
+    int r[4] = {};
+    __cpuidex(r, static_cast<int>(leaf), 0);
+    for (auto i = 0; i < 4; ++i) {
+        regs[i] = static_cast<std::uint32_t>(r[i]);
+    }
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+#endif
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Measure the frequency of \p Counter against \p Clock
+///
+/// The counter is read between two clock readings, which bound the instant of the counter read.
+/// Measurement continues until the relative error implied by those bounds falls below the
+/// tolerance of \p options, so a quiet system is calibrated in well under a millisecond while a
+/// noisy one measures for longer, up to the maximum duration of \p options.
+///
+/// The maximum duration is also enforced by \c std::chrono::steady_clock, so that a \p Clock
+/// that stalls or is too coarse to advance between samples cannot keep the measurement going.
+///
+/// \tparam Counter counter source, providing a static \c read() function as described for \ref
+/// frequencypp::tick_clock
+/// \tparam Clock \c std::chrono clock to measure against
+/// \param options limits on the calibration
+/// \return measured frequency of \p Counter, or zero if \p Clock did not advance within the
+/// maximum duration
+template<typename Counter, typename Clock = std::chrono::steady_clock>
+auto calibrate_frequency(const calibration_options& options = {}) -> hertz
+{
+    using std::chrono::duration;
+
+    const auto deadline = std::chrono::steady_clock::now() + options.max_duration;
+    const auto start = detail::take_calibration_sample<Counter, Clock>();
+    auto end = start;
+    auto elapsed = Clock::duration::zero();
+    for (;;) {
+        end = detail::take_calibration_sample<Counter, Clock>();
+        elapsed = end.midpoint() - start.midpoint();
+        if (elapsed > Clock::duration::zero()) {
+            const auto bound = duration<double>(start.uncertainty() + end.uncertainty())
+                / duration<double>(elapsed);
+            if ((elapsed >= options.min_duration && bound <= options.tolerance)
+                || elapsed >= options.max_duration)
+            {
+                break;
+            }
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+    if (elapsed <= Clock::duration::zero()) {
+        return hertz::zero();
+    }
+    const auto seconds = duration<long double>(elapsed).count();
+    return hertz{std::llround(static_cast<long double>(end.ticks - start.ticks) / seconds)};
+}
+
+/// Read the time-stamp counter frequency reported by the processor, using CPUID leaf 0x15 and, if
+/// the crystal frequency is not enumerated there, leaf 0x16
+///
+/// \return frequency of the time-stamp counter, or nothing if the processor does not report it
+inline auto tsc_frequency_from_cpuid() noexcept -> std::optional<hertz>
+{
+#if FREQUENCYPP_HAS_TSC
+    std::uint32_t regs[4] = {};
+    detail::cpuid(0, regs);
+    const auto max_leaf = regs[0];
+    if (max_leaf < 0x15) {
+        return std::nullopt;
+    }
+
+    // Leaf 0x15: TSC = crystal * EBX / EAX
+    detail::cpuid(0x15, regs);
+    const auto den = regs[0];
+    const auto num = regs[1];
+    const auto crystal = std::uint64_t{regs[2]};
+    if (den == 0 || num == 0) {
+        return std::nullopt;
+    }
+    if (crystal != 0) {
+        return hertz{static_cast<std::int64_t>(crystal * num / den)};
+    }
+
+    // Leaf 0x16 gives the base frequency in megahertz, which the TSC runs at
+    if (max_leaf < 0x16) {
+        return std::nullopt;
+    }
+    detail::cpuid(0x16, regs);
+    const auto base = std::uint64_t{regs[0] & 0xFFFFU};
+    if (base == 0) {
+        return std::nullopt;
+    }
+    return megahertz{static_cast<std::int64_t>(base)};
+#else
+    return std::nullopt;
+#endif
+}
+
+/// Read a time-stamp counter frequency in kilohertz exported by the kernel at \p path
+///
+/// Some Linux kernels export the \c tsc_khz value they calibrated at boot as
+/// \c /sys/devices/system/cpu/cpu0/tsc_freq_khz.
+///
+/// \param path file containing the frequency in kilohertz
+/// \return frequency read from \p path, or nothing if it is unreadable or malformed
+inline auto tsc_frequency_from_file(const char* path = "/sys/devices/system/cpu/cpu0/tsc_freq_khz")
+    -> std::optional<kilohertz>
+{
+    // C streams keep the iostreams out of the header
+    auto* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        return std::nullopt;
+    }
+    auto khz = std::int64_t{0};
+    const auto read = std::fscanf(file, "%" SCNd64, &khz);
+    static_cast<void>(std::fclose(file));
+    if (read != 1 || khz <= 0) {
+        return std::nullopt;
+    }
+    return kilohertz{khz};
+}
+
+#if FREQUENCYPP_HAS_TSC
+
+/// Get the frequency of the time-stamp counter
+///
+/// The frequency is taken from the first of these sources to provide one: CPUID, the kernel, and
+/// finally \ref frequencypp::calibrate_frequency against \c std::chrono::steady_clock.  The first
+/// positive result is cached, so later calls are free.  A calibration that fails is not cached,
+/// so the next call tries again.
+///
+/// \return frequency of the time-stamp counter, or zero if it could not be measured
+inline auto tsc_frequency() -> hertz
+{
+    static auto cached = std::atomic<hertz::rep>{0};
+    if (const auto f = cached.load(std::memory_order_relaxed); f > 0) {
+        return hertz{f};
+    }
+    const auto f = []() -> hertz {
+        if (const auto reported = tsc_frequency_from_cpuid()) {
+            return *reported;
+        }
+        if (const auto exported = tsc_frequency_from_file()) {
+            return *exported;
+        }
+        return calibrate_frequency<x86_tsc_source>();
+    }();
+    // Racing callers determine the same frequency, so whichever stores last is as good
+    if (f > hertz::zero()) {
+        cached.store(f.count(), std::memory_order_relaxed);
+    }
+    return f;
+}
+
+#endif
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_CALIBRATION_HPP
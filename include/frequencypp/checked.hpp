@@ -0,0 +1,387 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the overflow-checking integer representation \ref frequencypp::checked and its
+/// associated specializations
+
+#ifndef FREQUENCYPP_CHECKED_HPP
+#define FREQUENCYPP_CHECKED_HPP
+
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <type_traits>
+
+#include <frequencypp/detail/overflow.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+/// Integer representation that records overflow in a sticky flag instead of reporting it
+///
+/// Every operation on a checked value computes the wrapped result with the compiler's overflow
+/// builtins and ORs the overflow indication of the operation and of its operands into the flag of
+/// the result.  No operation branches or throws, so a batch of computations can run to completion
+/// and be validated once with \ref frequencypp::checked::overflowed or \ref
+/// frequencypp::any_overflow.  The flag is carried through \ref frequencypp::frequency_cast, which
+/// flags any multiplication by the period ratio or narrowing to the destination representation
+/// that loses the value.  Division by zero is flagged and yields the dividend.
+///
+/// \tparam Int integral type storing the value
+template<typename Int>
+class checked
+{
+    static_assert(detail::is_overflow_int_v<Int>, "Int must be a non-bool integral type");
+
+    using limits = std::numeric_limits<Int>;
+
+    Int value_;
+    bool overflowed_;
+
+    constexpr checked(Int v, bool overflowed) noexcept
+        : value_(v)
+        , overflowed_(overflowed)
+    {}
+
+    // Divisions by zero and the quotient min / -1 are diverted to a divisor of one and flagged
+    static constexpr auto bad_divisor(Int a, Int b) noexcept -> bool
+    {
+        if constexpr (limits::is_signed) {
+            return (b == Int{0}) | ((a == limits::min()) & (b == Int{-1}));
+        }
+        else {
+            static_cast<void>(a);
+            return b == Int{0};
+        }
+    }
+
+public:
+    /// Integral type storing the value
+    using value_type = Int;
+
+    /// Default-construct the value
+    checked() = default;
+
+    /// Construct the value from integer \p v, flagging it if it is not representable in \p Int
+    ///
+    /// \tparam T integral type of the value
+    /// \param v value to store
+    template<typename T, typename = std::enable_if_t<detail::is_overflow_int_v<T>>>
+    // Implicit conversions are desired for this constructor, as they enable arithmetic like
+    // f * 2 and construction like frequency<checked<int>>{5}
+    // NOLINTNEXTLINE
+    constexpr checked(T v) noexcept
+        : value_(static_cast<Int>(v))
+        , overflowed_(!detail::in_range<Int>(v))
+    {}
+
+    /// Construct the value from another checked value \p v, keeping its flag and flagging it if it
+    /// is not representable in \p Int
+    ///
+    /// \tparam T integral type of the value
+    /// \param v value to store
+    template<typename T>
+    constexpr explicit checked(checked<T> v) noexcept
+        : value_(static_cast<Int>(v.value()))
+        , overflowed_(v.overflowed() | !detail::in_range<Int>(v.value()))
+    {}
+
+    /// Get the stored value, which has wrapped if \ref frequencypp::checked::overflowed is set
+    ///
+    /// \return stored value
+    [[nodiscard]] constexpr auto value() const noexcept -> Int
+    {
+        return value_;
+    }
+
+    /// Determine whether this value or any value it was computed from overflowed
+    ///
+    /// \retval true if an overflow occurred
+    /// \retval false if the value is exact
+    [[nodiscard]] constexpr auto overflowed() const noexcept -> bool
+    {
+        return overflowed_;
+    }
+
+    /// Convert the value to arithmetic type \p T, as if by \c static_cast
+    ///
+    /// \tparam T arithmetic type to convert to
+    template<typename T,
+        typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    constexpr explicit operator T() const noexcept
+    {
+        return static_cast<T>(value_);
+    }
+
+    /// Determine whether the value is nonzero
+    constexpr explicit operator bool() const noexcept
+    {
+        return value_ != 0;
+    }
+
+    constexpr auto operator++() noexcept -> checked&
+    {
+        overflowed_ |= detail::add_overflow(value_, Int{1}, value_);
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> checked
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    constexpr auto operator--() noexcept -> checked&
+    {
+        overflowed_ |= detail::sub_overflow(value_, Int{1}, value_);
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> checked
+    {
+        auto copy = *this;
+        --*this;
+        return copy;
+    }
+
+    constexpr auto operator+=(checked rhs) noexcept -> checked&
+    {
+        overflowed_ |= rhs.overflowed_ | detail::add_overflow(value_, rhs.value_, value_);
+        return *this;
+    }
+
+    constexpr auto operator-=(checked rhs) noexcept -> checked&
+    {
+        overflowed_ |= rhs.overflowed_ | detail::sub_overflow(value_, rhs.value_, value_);
+        return *this;
+    }
+
+    constexpr auto operator*=(checked rhs) noexcept -> checked&
+    {
+        overflowed_ |= rhs.overflowed_ | detail::mul_overflow(value_, rhs.value_, value_);
+        return *this;
+    }
+
+    constexpr auto operator/=(checked rhs) noexcept -> checked&
+    {
+        const auto bad = bad_divisor(value_, rhs.value_);
+        value_ = static_cast<Int>(value_ / (bad ? Int{1} : rhs.value_));
+        overflowed_ |= rhs.overflowed_ | bad;
+        return *this;
+    }
+
+    constexpr auto operator%=(checked rhs) noexcept -> checked&
+    {
+        const auto bad = bad_divisor(value_, rhs.value_);
+        value_ = static_cast<Int>(value_ % (bad ? Int{1} : rhs.value_));
+        overflowed_ |= rhs.overflowed_ | bad;
+        return *this;
+    }
+
+    friend constexpr auto operator+(checked v) noexcept -> checked
+    {
+        return v;
+    }
+
+    friend constexpr auto operator-(checked v) noexcept -> checked
+    {
+        return checked{Int{0}, v.overflowed_} -= v;
+    }
+
+    friend constexpr auto operator+(checked lhs, checked rhs) noexcept -> checked
+    {
+        return lhs += rhs;
+    }
+
+    friend constexpr auto operator-(checked lhs, checked rhs) noexcept -> checked
+    {
+        return lhs -= rhs;
+    }
+
+    friend constexpr auto operator*(checked lhs, checked rhs) noexcept -> checked
+    {
+        return lhs *= rhs;
+    }
+
+    friend constexpr auto operator/(checked lhs, checked rhs) noexcept -> checked
+    {
+        return lhs /= rhs;
+    }
+
+    friend constexpr auto operator%(checked lhs, checked rhs) noexcept -> checked
+    {
+        return lhs %= rhs;
+    }
+
+    // Comparisons consider only the stored values, so that the flag can be inspected separately
+
+    friend constexpr auto operator==(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend constexpr auto operator!=(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend constexpr auto operator<(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ < rhs.value_;
+    }
+
+    friend constexpr auto operator<=(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ <= rhs.value_;
+    }
+
+    friend constexpr auto operator>(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ > rhs.value_;
+    }
+
+    friend constexpr auto operator>=(checked lhs, checked rhs) noexcept -> bool
+    {
+        return lhs.value_ >= rhs.value_;
+    }
+
+    /// Inserts the stored value of \p v into \p os, followed by \c "(overflow)" if it overflowed
+    template<typename CharT, typename Traits>
+    friend auto operator<<(std::basic_ostream<CharT, Traits>& os, checked v)
+        -> std::basic_ostream<CharT, Traits>&
+    {
+        // Promote narrow types so that int8_t is not inserted as a character
+        os << +v.value_;
+        if (v.overflowed_) {
+            os << "(overflow)";
+        }
+        return os;
+    }
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T, typename U, typename = void>
+struct checked_common_type
+{};
+
+template<typename T, typename U>
+struct checked_common_type<T, U, std::enable_if_t<is_overflow_int_v<U>>>
+{
+    using type = checked<std::common_type_t<T, U>>;
+};
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::common_type for two \ref frequencypp::checked types
+template<typename T, typename U>
+struct std::common_type<frequencypp::checked<T>, frequencypp::checked<U>>
+{
+    /// Checked type over the common type of \p T and \p U
+    using type = frequencypp::checked<std::common_type_t<T, U>>;
+};
+
+/// Specialization of std::common_type for a \ref frequencypp::checked type and an integral type
+template<typename T, typename U>
+struct std::common_type<frequencypp::checked<T>, U> : frequencypp::detail::checked_common_type<T, U>
+{};
+
+/// Specialization of std::common_type for an integral type and a \ref frequencypp::checked type
+template<typename T, typename U>
+struct std::common_type<U, frequencypp::checked<T>> : frequencypp::detail::checked_common_type<T, U>
+{};
+
+/// Specialization of std::numeric_limits for \ref frequencypp::checked
+template<typename Int>
+class std::numeric_limits<frequencypp::checked<Int>> : public std::numeric_limits<Int>
+{
+public:
+    static constexpr auto min() noexcept -> frequencypp::checked<Int>
+    {
+        return std::numeric_limits<Int>::min();
+    }
+
+    static constexpr auto lowest() noexcept -> frequencypp::checked<Int>
+    {
+        return std::numeric_limits<Int>::lowest();
+    }
+
+    static constexpr auto max() noexcept -> frequencypp::checked<Int>
+    {
+        return std::numeric_limits<Int>::max();
+    }
+};
+
+namespace frequencypp {
+
+/// Specialization of \ref frequencypp::frequency_values for \ref frequencypp::checked, whose
+/// values are never flagged
+///
+/// \tparam Int integral type storing the value
+template<typename Int>
+struct frequency_values<checked<Int>>
+{
+    /// Gets the zero-length representation
+    ///
+    /// \return zero-length representation
+    static constexpr auto zero() noexcept -> checked<Int>
+    {
+        return Int{0};
+    }
+
+    /// Gets the smallest possible representation
+    ///
+    /// \return smallest possible representation
+    static constexpr auto min() noexcept -> checked<Int>
+    {
+        return std::numeric_limits<Int>::min();
+    }
+
+    /// Gets the largest possible representation
+    ///
+    /// \return largest possible representation
+    static constexpr auto max() noexcept -> checked<Int>
+    {
+        return std::numeric_limits<Int>::max();
+    }
+};
+
+/// Determine whether any of the frequencies in \p fs overflowed
+///
+/// The flags are combined without branching, so a whole batch is validated with one test.
+///
+/// \tparam Int integral type storing the tick counts
+/// \tparam Period ratio representing the tick period
+/// \param fs frequencies to inspect
+/// \param n number of frequencies in \p fs
+/// \retval true if any frequency in \p fs overflowed
+/// \retval false if every frequency in \p fs is exact
+template<typename Int, typename Period>
+constexpr auto any_overflow(const frequency<checked<Int>, Period>* fs, std::size_t n) noexcept
+    -> bool
+{
+    auto overflowed = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        overflowed |= fs[i].count().overflowed();
+    }
+    return overflowed;
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_CHECKED_HPP
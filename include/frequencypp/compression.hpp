@@ -0,0 +1,455 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the block-based compressor \ref frequencypp::frequency_encoder and decompressor \ref
+/// frequencypp::frequency_decoder for time series of \ref frequencypp::frequency values
+
+#ifndef FREQUENCYPP_COMPRESSION_HPP
+#define FREQUENCYPP_COMPRESSION_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+constexpr auto countl_zero(std::uint64_t x) noexcept -> int
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x == 0 ? 64 : __builtin_clzll(x);
+#else
+    auto n = 0;
+    for (auto bit = std::uint64_t{1} << 63; bit != 0 && (x & bit) == 0; bit >>= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+constexpr auto countr_zero(std::uint64_t x) noexcept -> int
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x == 0 ? 64 : __builtin_ctzll(x);
+#else
+    auto n = 0;
+    for (auto bit = std::uint64_t{1}; bit != 0 && (x & bit) == 0; bit <<= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+constexpr auto low_bits(int n) noexcept -> std::uint64_t
+{
+    return n >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+}
+
+constexpr auto zigzag_encode(std::uint64_t v) noexcept -> std::uint64_t
+{
+    // Operates on the two's complement bits of v, so wrapped differences round-trip exactly
+    return (v << 1) ^ (std::uint64_t{0} - (v >> 63));
+}
+
+constexpr auto zigzag_decode(std::uint64_t v) noexcept -> std::uint64_t
+{
+    return (v >> 1) ^ (std::uint64_t{0} - (v & 1));
+}
+
+/// Appends variable-width bit fields to a vector of little-endian words
+class bit_writer
+{
+    std::vector<std::uint64_t>* words_;
+    int used_ = 64;
+
+public:
+    explicit bit_writer(std::vector<std::uint64_t>& words) noexcept
+        : words_(&words)
+    {}
+
+    /// Append the low \p n bits of \p v, where \p v has no bits set above them
+    void write(std::uint64_t v, int n)
+    {
+        if (n == 0) {
+            return;
+        }
+        if (used_ == 64) {
+            words_->push_back(0);
+            used_ = 0;
+        }
+        words_->back() |= v << used_;
+        if (used_ + n > 64) {
+            words_->push_back(v >> (64 - used_));
+            used_ += n - 64;
+        }
+        else {
+            used_ += n;
+        }
+    }
+
+    /// Start the next field on a fresh word
+    void align() noexcept
+    {
+        used_ = 64;
+    }
+};
+
+/// Reads variable-width bit fields from an array of little-endian words
+class bit_reader
+{
+    const std::uint64_t* words_;
+    std::size_t position_ = 0;
+
+public:
+    explicit bit_reader(const std::uint64_t* words) noexcept
+        : words_(words)
+    {}
+
+    auto read(int n) noexcept -> std::uint64_t
+    {
+        if (n == 0) {
+            return 0;
+        }
+        const auto word = position_ / 64;
+        const auto offset = static_cast<int>(position_ % 64);
+        auto v = words_[word] >> offset;
+        if (offset + n > 64) {
+            v |= words_[word + 1] << (64 - offset);
+        }
+        position_ += static_cast<std::size_t>(n);
+        return v & low_bits(n);
+    }
+};
+
+template<typename Rep>
+auto to_bits(Rep r) noexcept -> std::uint64_t
+{
+    if constexpr (std::is_floating_point_v<Rep>) {
+        using uint = std::conditional_t<sizeof(Rep) == 4, std::uint32_t, std::uint64_t>;
+        auto u = uint{};
+        std::memcpy(&u, &r, sizeof(r));
+        return u;
+    }
+    else {
+        return static_cast<std::uint64_t>(r);
+    }
+}
+
+template<typename Rep>
+auto from_bits(std::uint64_t v) noexcept -> Rep
+{
+    if constexpr (std::is_floating_point_v<Rep>) {
+        using uint = std::conditional_t<sizeof(Rep) == 4, std::uint32_t, std::uint64_t>;
+        const auto u = static_cast<uint>(v);
+        auto r = Rep{};
+        std::memcpy(&r, &u, sizeof(r));
+        return r;
+    }
+    else {
+        return static_cast<Rep>(v);
+    }
+}
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Append-only compressor for time series of frequencies of type \p Frequency
+///
+/// Frequencies are grouped into blocks of \p BlockSize values, each of which is encoded
+/// independently and starts on a word boundary so that it can be decoded without touching its
+/// predecessors.  Integral tick counts are encoded as delta-of-deltas, zigzag mapped and
+/// bit-packed at the narrowest width that holds every value in the block, which costs a handful of
+/// bits per value for slowly changing series and decodes without data-dependent branches.
+/// Floating-point tick counts are encoded by XOR with their predecessor, storing only the
+/// meaningful bits of the result, as in Facebook's Gorilla time series database.
+///
+/// Values appended since the last completed block are buffered and only become part of the
+/// encoded stream once the block fills or \ref frequencypp::frequency_encoder::flush is called.
+///
+/// \tparam Frequency \ref frequencypp::frequency type to compress
+/// \tparam BlockSize number of values in each block
+template<typename Frequency, std::size_t BlockSize = 256>
+class frequency_encoder
+{
+    using rep = typename Frequency::rep;
+
+    static_assert(detail::is_frequency_v<Frequency>, "Frequency must be a frequency");
+    static_assert((std::is_integral_v<rep> && sizeof(rep) <= 8) || std::is_same_v<rep, float>
+            || std::is_same_v<rep, double>,
+        "rep must be an integral type of at most 64 bits, float, or double");
+    static_assert(BlockSize >= 2 && BlockSize < (std::size_t{1} << 32), "BlockSize out of range");
+
+    std::vector<std::uint64_t> words_;
+    std::vector<std::size_t> offsets_;
+    std::array<rep, BlockSize> pending_{};
+    std::size_t pending_size_ = 0;
+    std::size_t size_ = 0;
+
+    void encode_integral(detail::bit_writer& w) const
+    {
+        const auto* v = pending_.data();
+        const auto n = pending_size_;
+        w.write(detail::to_bits(v[0]), 64);
+        if (n == 1) {
+            return;
+        }
+        auto prev = detail::to_bits(v[1]);
+        auto delta = prev - detail::to_bits(v[0]);
+        w.write(detail::zigzag_encode(delta), 64);
+
+        // Pack every delta-of-delta at the width of the widest one
+        auto zz = std::array<std::uint64_t, BlockSize>{};
+        auto widest = std::uint64_t{0};
+        for (std::size_t i = 2; i < n; ++i) {
+            const auto cur = detail::to_bits(v[i]);
+            const auto next_delta = cur - prev;
+            zz[i] = detail::zigzag_encode(next_delta - delta);
+            widest |= zz[i];
+            delta = next_delta;
+            prev = cur;
+        }
+        const auto width = 64 - detail::countl_zero(widest);
+        w.write(static_cast<std::uint64_t>(width), 7);
+        for (std::size_t i = 2; i < n; ++i) {
+            w.write(zz[i], width);
+        }
+    }
+
+    void encode_floating(detail::bit_writer& w) const
+    {
+        constexpr auto bits = static_cast<int>(sizeof(rep) * 8);
+        const auto* v = pending_.data();
+        auto prev = detail::to_bits(v[0]);
+        w.write(prev, bits);
+        auto lead = bits + 1;
+        auto trail = 0;
+        for (std::size_t i = 1; i < pending_size_; ++i) {
+            const auto cur = detail::to_bits(v[i]);
+            const auto x = cur ^ prev;
+            prev = cur;
+            if (x == 0) {
+                w.write(0, 1);
+                continue;
+            }
+            const auto l = detail::countl_zero(x) - (64 - bits);
+            const auto t = detail::countr_zero(x);
+            if (l >= lead && t >= trail) {
+                // Fits in the window of meaningful bits of the previous value
+                w.write(0b01, 2);
+                w.write(x >> trail, bits - lead - trail);
+            }
+            else {
+                lead = l;
+                trail = t;
+                const auto length = bits - lead - trail;
+                w.write(0b11, 2);
+                w.write(static_cast<std::uint64_t>(lead), 6);
+                w.write(static_cast<std::uint64_t>(length - 1), 6);
+                w.write(x >> trail, length);
+            }
+        }
+    }
+
+public:
+    /// Number of values in each complete block
+    static constexpr auto block_size = BlockSize;
+
+    /// Append frequency \p f to the series
+    ///
+    /// \param f frequency to append
+    void append(const Frequency& f)
+    {
+        pending_[pending_size_++] = f.count();
+        ++size_;
+        if (pending_size_ == BlockSize) {
+            flush();
+        }
+    }
+
+    /// Encode the buffered values as a block, which may be shorter than \p BlockSize
+    void flush()
+    {
+        if (pending_size_ == 0) {
+            return;
+        }
+        offsets_.push_back(words_.size());
+        auto w = detail::bit_writer{words_};
+        w.write(pending_size_, 64);
+        if constexpr (std::is_integral_v<rep>) {
+            encode_integral(w);
+        }
+        else {
+            encode_floating(w);
+        }
+        pending_size_ = 0;
+    }
+
+    /// Get the number of values appended, including buffered values
+    ///
+    /// \return number of values appended
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    /// Get the encoded stream, in which block \c i starts at word \c block_offsets()[i]
+    ///
+    /// \return encoded words
+    [[nodiscard]] auto words() const noexcept -> const std::vector<std::uint64_t>&
+    {
+        return words_;
+    }
+
+    /// Get the word offset of every encoded block
+    ///
+    /// \return word offset of every encoded block
+    [[nodiscard]] auto block_offsets() const noexcept -> const std::vector<std::size_t>&
+    {
+        return offsets_;
+    }
+};
+
+/// Decompressor for the blocks produced by \ref frequencypp::frequency_encoder
+///
+/// The decoder is a non-owning view over the encoded words and block offsets, which must outlive
+/// it.  Any block can be decoded on its own, so random access costs at most one block decode.
+///
+/// \tparam Frequency \ref frequencypp::frequency type to decompress
+template<typename Frequency>
+class frequency_decoder
+{
+    using rep = typename Frequency::rep;
+
+    const std::uint64_t* words_;
+    const std::size_t* offsets_;
+    std::size_t block_count_;
+
+    static void decode_integral(detail::bit_reader& r, std::size_t n, Frequency* out) noexcept
+    {
+        auto prev = r.read(64);
+        out[0] = Frequency{detail::from_bits<rep>(prev)};
+        if (n == 1) {
+            return;
+        }
+        auto delta = detail::zigzag_decode(r.read(64));
+        prev += delta;
+        out[1] = Frequency{detail::from_bits<rep>(prev)};
+        const auto width = static_cast<int>(r.read(7));
+        for (std::size_t i = 2; i < n; ++i) {
+            delta += detail::zigzag_decode(r.read(width));
+            prev += delta;
+            out[i] = Frequency{detail::from_bits<rep>(prev)};
+        }
+    }
+
+    static void decode_floating(detail::bit_reader& r, std::size_t n, Frequency* out) noexcept
+    {
+        constexpr auto bits = static_cast<int>(sizeof(rep) * 8);
+        auto prev = r.read(bits);
+        out[0] = Frequency{detail::from_bits<rep>(prev)};
+        auto lead = 0;
+        auto trail = 0;
+        for (std::size_t i = 1; i < n; ++i) {
+            if (r.read(1) != 0) {
+                if (r.read(1) != 0) {
+                    lead = static_cast<int>(r.read(6));
+                    trail = bits - lead - (static_cast<int>(r.read(6)) + 1);
+                }
+                prev ^= r.read(bits - lead - trail) << trail;
+            }
+            out[i] = Frequency{detail::from_bits<rep>(prev)};
+        }
+    }
+
+public:
+    /// Construct a decoder over \p block_count blocks of \p words starting at \p offsets
+    ///
+    /// \param words encoded words
+    /// \param offsets word offset of every block
+    /// \param block_count number of blocks
+    frequency_decoder(
+        const std::uint64_t* words, const std::size_t* offsets, std::size_t block_count) noexcept
+        : words_(words)
+        , offsets_(offsets)
+        , block_count_(block_count)
+    {}
+
+    /// Construct a decoder over the blocks encoded so far by \p e
+    ///
+    /// \tparam BlockSize number of values in each block of \p e
+    /// \param e encoder to decode from
+    template<std::size_t BlockSize>
+    explicit frequency_decoder(const frequency_encoder<Frequency, BlockSize>& e) noexcept
+        : frequency_decoder(e.words().data(), e.block_offsets().data(), e.block_offsets().size())
+    {}
+
+    /// Get the number of blocks
+    ///
+    /// \return number of blocks
+    [[nodiscard]] auto block_count() const noexcept -> std::size_t
+    {
+        return block_count_;
+    }
+
+    /// Get the number of values in block \p i
+    ///
+    /// \param i index of the block
+    /// \return number of values in block \p i
+    [[nodiscard]] auto block_size(std::size_t i) const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(words_[offsets_[i]]);
+    }
+
+    /// Decode block \p i into \p out, which must have room for \ref
+    /// frequencypp::frequency_decoder::block_size values
+    ///
+    /// \param i index of the block
+    /// \param out frequencies to store the decoded values in
+    /// \return number of values decoded
+    auto decode_block(std::size_t i, Frequency* out) const noexcept -> std::size_t
+    {
+        auto r = detail::bit_reader{words_ + offsets_[i]};
+        const auto n = static_cast<std::size_t>(r.read(64));
+        if constexpr (std::is_integral_v<rep>) {
+            decode_integral(r, n, out);
+        }
+        else {
+            decode_floating(r, n, out);
+        }
+        return n;
+    }
+
+    /// Decode every block into \p out, which must have room for every encoded value
+    ///
+    /// \param out frequencies to store the decoded values in
+    /// \return number of values decoded
+    auto decode(Frequency* out) const noexcept -> std::size_t
+    {
+        auto n = std::size_t{0};
+        for (std::size_t i = 0; i < block_count_; ++i) {
+            n += decode_block(i, out + n);
+        }
+        return n;
+    }
+};
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_COMPRESSION_HPP
@@ -0,0 +1,36 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains macros applying compiler-specific attributes to the functions of frequencypp
+
+#ifndef FREQUENCYPP_DETAIL_ATTRIBUTES_HPP
+#define FREQUENCYPP_DETAIL_ATTRIBUTES_HPP
+
+/// \def FREQUENCYPP_INLINE
+/// Marks a trivial function to be inlined even in unoptimized builds
+///
+/// Defining \c FREQUENCYPP_FORCE_INLINE before including any frequencypp header makes this expand
+/// to attributes that force GCC and Clang to inline the function at every optimization level, and
+/// that make debuggers step over it as they would a built-in operation.  Otherwise it expands to
+/// nothing, leaving inlining to the optimizer.  Arithmetic on \ref frequencypp::frequency passes
+/// through several layers of such functions, so unoptimized builds that define the macro run
+/// nearly as fast as if they used raw integers.
+#if defined(FREQUENCYPP_FORCE_INLINE) && (defined(__GNUC__) || defined(__clang__))
+#define FREQUENCYPP_INLINE [[gnu::always_inline, gnu::artificial]]
+#else
+#define FREQUENCYPP_INLINE
+#endif
+
+#endif // FREQUENCYPP_DETAIL_ATTRIBUTES_HPP
@@ -0,0 +1,62 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the 128-bit integer types supported as frequency representations, where the compiler
+/// provides them
+
+#ifndef FREQUENCYPP_DETAIL_INT128_HPP
+#define FREQUENCYPP_DETAIL_INT128_HPP
+
+#include <type_traits>
+
+/// \def FREQUENCYPP_HAS_INT128
+/// Whether the compiler provides \c __int128, and so \ref frequencypp::int128_t and \ref
+/// frequencypp::uint128_t are defined
+#if defined(__SIZEOF_INT128__)
+#define FREQUENCYPP_HAS_INT128 1
+#else
+#define FREQUENCYPP_HAS_INT128 0
+#endif
+
+#if FREQUENCYPP_HAS_INT128
+
+namespace frequencypp {
+
+// The types are extensions, which pedantic warnings would otherwise flag wherever they are named
+
+/// Signed 128-bit integer type, for tick counts beyond the range of \c std::int64_t
+__extension__ typedef __int128 int128_t;
+
+/// Unsigned 128-bit integer type, for tick counts beyond the range of \c std::uint64_t
+__extension__ typedef unsigned __int128 uint128_t;
+
+} // namespace frequencypp
+
+#endif
+
+namespace frequencypp::detail {
+
+// Strict standard modes do not classify the 128-bit types as integral, so they are detected by name
+template<typename T>
+constexpr bool is_int128_v =
+#if FREQUENCYPP_HAS_INT128
+    std::is_same_v<std::remove_cv_t<T>, int128_t> || std::is_same_v<std::remove_cv_t<T>, uint128_t>;
+#else
+    false;
+#endif
+
+} // namespace frequencypp::detail
+
+#endif // FREQUENCYPP_DETAIL_INT128_HPP
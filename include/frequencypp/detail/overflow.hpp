@@ -0,0 +1,172 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains overflow-detecting integer primitives shared by the integer representation adapters
+
+#ifndef FREQUENCYPP_DETAIL_OVERFLOW_HPP
+#define FREQUENCYPP_DETAIL_OVERFLOW_HPP
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FREQUENCYPP_HAS_OVERFLOW_BUILTINS 1
+#else
+#define FREQUENCYPP_HAS_OVERFLOW_BUILTINS 0
+#endif
+
+namespace frequencypp::detail {
+
+template<typename T>
+constexpr bool is_overflow_int_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+/// Add \p a and \p b, storing the wrapped sum in \p r
+///
+/// \return whether the mathematical sum is not representable in \p Int
+template<typename Int>
+constexpr auto add_overflow(Int a, Int b, Int& r) noexcept -> bool
+{
+#if FREQUENCYPP_HAS_OVERFLOW_BUILTINS
+    return __builtin_add_overflow(a, b, &r);
+#else
+    using uint = std::make_unsigned_t<Int>;
+    const auto ur = static_cast<uint>(static_cast<uint>(a) + static_cast<uint>(b));
+    r = static_cast<Int>(ur);
+    if constexpr (std::is_signed_v<Int>) {
+        return ((a ^ r) & (b ^ r)) < 0;
+    }
+    else {
+        return ur < static_cast<uint>(a);
+    }
+#endif
+}
+
+/// Subtract \p b from \p a, storing the wrapped difference in \p r
+///
+/// \return whether the mathematical difference is not representable in \p Int
+template<typename Int>
+constexpr auto sub_overflow(Int a, Int b, Int& r) noexcept -> bool
+{
+#if FREQUENCYPP_HAS_OVERFLOW_BUILTINS
+    return __builtin_sub_overflow(a, b, &r);
+#else
+    using uint = std::make_unsigned_t<Int>;
+    const auto ur = static_cast<uint>(static_cast<uint>(a) - static_cast<uint>(b));
+    r = static_cast<Int>(ur);
+    if constexpr (std::is_signed_v<Int>) {
+        return ((a ^ b) & (a ^ r)) < 0;
+    }
+    else {
+        return static_cast<uint>(b) > static_cast<uint>(a);
+    }
+#endif
+}
+
+/// Multiply \p a by \p b, storing the wrapped product in \p r
+///
+/// \return whether the mathematical product is not representable in \p Int
+template<typename Int>
+constexpr auto mul_overflow(Int a, Int b, Int& r) noexcept -> bool
+{
+#if FREQUENCYPP_HAS_OVERFLOW_BUILTINS
+    return __builtin_mul_overflow(a, b, &r);
+#else
+    using uint = std::make_unsigned_t<Int>;
+    if constexpr (sizeof(Int) < sizeof(std::int64_t)) {
+        using wide = std::conditional_t<std::is_signed_v<Int>, std::int64_t, std::uint64_t>;
+        const auto w = static_cast<wide>(a) * static_cast<wide>(b);
+        r = static_cast<Int>(w);
+        return w != static_cast<wide>(r);
+    }
+    else if constexpr (std::is_signed_v<Int>) {
+        r = static_cast<Int>(static_cast<uint>(a) * static_cast<uint>(b));
+        if (a == 0 || b == 0) {
+            return false;
+        }
+        const auto ua = a < 0 ? uint{0} - static_cast<uint>(a) : static_cast<uint>(a);
+        const auto ub = b < 0 ? uint{0} - static_cast<uint>(b) : static_cast<uint>(b);
+        const auto limit = static_cast<uint>(std::numeric_limits<Int>::max()) + ((a < 0) != (b < 0));
+        return ua > limit / ub;
+    }
+    else {
+        r = static_cast<Int>(a * b);
+        return a != 0 && r / a != b;
+    }
+#endif
+}
+
+/// Get the saturation limit of \p Int in the direction given by the sign bit of \p sign
+///
+/// \return maximum of \p Int if \p sign is non-negative, otherwise minimum of \p Int
+template<typename Int>
+constexpr auto saturation_limit(Int sign) noexcept -> Int
+{
+    if constexpr (std::is_signed_v<Int>) {
+        using uint = std::make_unsigned_t<Int>;
+        constexpr auto shift = std::numeric_limits<Int>::digits;
+        return static_cast<Int>(static_cast<uint>(static_cast<uint>(sign) >> shift)
+            + static_cast<uint>(std::numeric_limits<Int>::max()));
+    }
+    else {
+        static_cast<void>(sign);
+        return std::numeric_limits<Int>::max();
+    }
+}
+
+/// Determine whether integer \p a compares less than integer \p b without sign conversion
+template<typename T, typename U>
+constexpr auto cmp_less(T a, U b) noexcept -> bool
+{
+    if constexpr (std::is_signed_v<T> == std::is_signed_v<U>) {
+        return a < b;
+    }
+    else if constexpr (std::is_signed_v<T>) {
+        return a < 0 || static_cast<std::make_unsigned_t<T>>(a) < b;
+    }
+    else {
+        return b >= 0 && a < static_cast<std::make_unsigned_t<U>>(b);
+    }
+}
+
+/// Determine whether integer \p v is representable in \p Int
+template<typename Int, typename T>
+constexpr auto in_range(T v) noexcept -> bool
+{
+    return !cmp_less(v, std::numeric_limits<Int>::min())
+        && !cmp_less(std::numeric_limits<Int>::max(), v);
+}
+
+/// Convert integer \p v to \p Int, clamping it to the limits of \p Int
+template<typename Int, typename T>
+constexpr auto clamp_to(T v) noexcept -> Int
+{
+    constexpr auto lo = std::numeric_limits<Int>::min();
+    constexpr auto hi = std::numeric_limits<Int>::max();
+    if constexpr (!cmp_less(std::numeric_limits<T>::min(), lo)
+        && !cmp_less(hi, std::numeric_limits<T>::max()))
+    {
+        return static_cast<Int>(v);
+    }
+    else {
+        const auto low = cmp_less(v, lo);
+        const auto high = cmp_less(hi, v);
+        return low ? lo : (high ? hi : static_cast<Int>(v));
+    }
+}
+
+} // namespace frequencypp::detail
+
+#endif // FREQUENCYPP_DETAIL_OVERFLOW_HPP
@@ -0,0 +1,373 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the opt-in expression templates \ref frequencypp::frequency_expression, which evaluate
+/// chains of frequency sums and scalings in one pass
+
+#ifndef FREQUENCYPP_EXPRESSION_HPP
+#define FREQUENCYPP_EXPRESSION_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <frequencypp/detail/attributes.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+// Each node evaluates the tick count of its value at index i of the expression, in the period and
+// representation of frequency type To
+
+/// Frequency operand of an expression, which has the same value at every index
+template<typename Frequency>
+struct expr_value
+{
+    using result_type = Frequency;
+
+    Frequency f;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t) const -> typename To::rep
+    {
+        return frequency_cast<To>(f).count();
+    }
+};
+
+/// Frequency operand of an expression whose value at each index is an element of an array
+template<typename Frequency>
+struct expr_span
+{
+    using result_type = Frequency;
+
+    const Frequency* p;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t i) const -> typename To::rep
+    {
+        return frequency_cast<To>(p[i]).count();
+    }
+};
+
+/// Sum or difference of two expressions
+template<typename L, typename R, bool Subtract>
+struct expr_sum
+{
+    using result_type =
+        std::common_type_t<typename L::result_type, typename R::result_type>;
+
+    L lhs;
+    R rhs;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t i) const -> typename To::rep
+    {
+        using rep = typename To::rep;
+        if constexpr (Subtract) {
+            return static_cast<rep>(lhs.template eval<To>(i) - rhs.template eval<To>(i));
+        }
+        else {
+            return static_cast<rep>(lhs.template eval<To>(i) + rhs.template eval<To>(i));
+        }
+    }
+};
+
+/// Negation of an expression
+template<typename E>
+struct expr_negate
+{
+    using result_type = typename E::result_type;
+
+    E e;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t i) const -> typename To::rep
+    {
+        return static_cast<typename To::rep>(-e.template eval<To>(i));
+    }
+};
+
+/// Product of an expression and a scalar
+///
+/// Scaling to a finer period multiplies by an integer, so it commutes with the product and the
+/// operand of the product is scaled directly to the period of the whole expression.
+template<typename E, typename Scalar>
+struct expr_multiply
+{
+    using result_type = frequency<std::common_type_t<typename E::result_type::rep, Scalar>,
+        typename E::result_type::period>;
+
+    E e;
+    Scalar s;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t i) const -> typename To::rep
+    {
+        return static_cast<typename To::rep>(e.template eval<To>(i) * s);
+    }
+};
+
+/// Quotient of an expression and a scalar
+///
+/// An integral quotient truncates in the period of its operand, which does not commute with
+/// scaling, so the operand is evaluated in its own period and only the quotient is scaled to the
+/// period of the whole expression.
+template<typename E, typename Scalar>
+struct expr_divide
+{
+    using result_type = frequency<std::common_type_t<typename E::result_type::rep, Scalar>,
+        typename E::result_type::period>;
+
+    E e;
+    Scalar s;
+
+    template<typename To>
+    FREQUENCYPP_INLINE constexpr auto eval(std::size_t i) const -> typename To::rep
+    {
+        using rep = typename result_type::rep;
+        const auto q = result_type{static_cast<rep>(e.template eval<result_type>(i) / s)};
+        return frequency_cast<To>(q).count();
+    }
+};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Unevaluated chain of sums, differences, and scalings of frequencies
+///
+/// Adding frequencies of different periods one pair at a time converts each partial sum to the
+/// common type of the next pair, so an operand early in a long chain is converted once per
+/// operator.  An expression instead records the chain and finds the common type of all of its
+/// operands once; evaluation converts each operand directly to that type and combines the counts,
+/// so every operand is scaled exactly once.  The result is the same as that of the binary operators
+/// except for rounding of floating-point representations.
+///
+/// Expressions are opt-in, created by wrapping an operand in \ref frequencypp::expr::lazy or, to
+/// evaluate over arrays, \ref frequencypp::expr::each.  Further frequencies, expressions, and
+/// scalars combine with them using \c +, \c -, \c *, and \c /.
+///
+/// \tparam Node type of the root of the expression tree
+template<typename Node>
+class frequency_expression
+{
+    Node node_;
+
+public:
+    /// \ref frequencypp::frequency type of the result, which is the common type of the operands
+    using result_type = typename Node::result_type;
+
+    /// Construct the expression with root \p node
+    ///
+    /// \param node root of the expression tree
+    FREQUENCYPP_INLINE constexpr explicit frequency_expression(const Node& node)
+        : node_(node)
+    {}
+
+    /// Get the root of the expression tree
+    ///
+    /// \return root of the expression tree
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto node() const -> const Node&
+    {
+        return node_;
+    }
+
+    /// Evaluate the expression at index \p i of its array operands
+    ///
+    /// \param i index of the elements of array operands to use
+    /// \return value of the expression
+    FREQUENCYPP_INLINE constexpr auto operator[](std::size_t i) const -> result_type
+    {
+        return result_type{node_.template eval<result_type>(i)};
+    }
+
+    /// Evaluate the expression, which must not have array operands
+    // Implicit conversions are desired for this operator, as they enable initialization like
+    // hertz f = lazy(a) + b
+    // NOLINTNEXTLINE
+    FREQUENCYPP_INLINE constexpr operator result_type() const
+    {
+        return (*this)[0];
+    }
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T>
+struct is_frequency_expression : std::false_type
+{};
+
+template<typename Node>
+struct is_frequency_expression<frequency_expression<Node>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_scalar_operand_v =
+    !is_frequency_v<T> && !is_frequency_expression<T>::value && !is_duration_v<T>;
+
+template<typename Node>
+FREQUENCYPP_INLINE constexpr auto make_expression(const Node& node) -> frequency_expression<Node>
+{
+    return frequency_expression<Node>{node};
+}
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+// Combining an expression with a frequency, another expression, or a scalar extends the expression
+
+template<typename N1, typename N2>
+FREQUENCYPP_INLINE constexpr auto operator+(
+    const frequency_expression<N1>& lhs, const frequency_expression<N2>& rhs)
+{
+    return detail::make_expression(detail::expr_sum<N1, N2, false>{lhs.node(), rhs.node()});
+}
+
+template<typename N1, typename N2>
+FREQUENCYPP_INLINE constexpr auto operator-(
+    const frequency_expression<N1>& lhs, const frequency_expression<N2>& rhs)
+{
+    return detail::make_expression(detail::expr_sum<N1, N2, true>{lhs.node(), rhs.node()});
+}
+
+template<typename Node, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto operator+(
+    const frequency_expression<Node>& lhs, const frequency<Rep, Period>& rhs)
+{
+    using value = detail::expr_value<frequency<Rep, Period>>;
+    return detail::make_expression(detail::expr_sum<Node, value, false>{lhs.node(), value{rhs}});
+}
+
+template<typename Node, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto operator-(
+    const frequency_expression<Node>& lhs, const frequency<Rep, Period>& rhs)
+{
+    using value = detail::expr_value<frequency<Rep, Period>>;
+    return detail::make_expression(detail::expr_sum<Node, value, true>{lhs.node(), value{rhs}});
+}
+
+template<typename Rep, typename Period, typename Node>
+FREQUENCYPP_INLINE constexpr auto operator+(
+    const frequency<Rep, Period>& lhs, const frequency_expression<Node>& rhs)
+{
+    using value = detail::expr_value<frequency<Rep, Period>>;
+    return detail::make_expression(detail::expr_sum<value, Node, false>{value{lhs}, rhs.node()});
+}
+
+template<typename Rep, typename Period, typename Node>
+FREQUENCYPP_INLINE constexpr auto operator-(
+    const frequency<Rep, Period>& lhs, const frequency_expression<Node>& rhs)
+{
+    using value = detail::expr_value<frequency<Rep, Period>>;
+    return detail::make_expression(detail::expr_sum<value, Node, true>{value{lhs}, rhs.node()});
+}
+
+template<typename Node>
+FREQUENCYPP_INLINE constexpr auto operator-(const frequency_expression<Node>& e)
+{
+    return detail::make_expression(detail::expr_negate<Node>{e.node()});
+}
+
+template<typename Node,
+    typename Scalar,
+    typename = std::enable_if_t<detail::is_scalar_operand_v<Scalar>>>
+FREQUENCYPP_INLINE constexpr auto operator*(
+    const frequency_expression<Node>& lhs, const Scalar& rhs)
+{
+    return detail::make_expression(detail::expr_multiply<Node, Scalar>{lhs.node(), rhs});
+}
+
+template<typename Scalar,
+    typename Node,
+    typename = std::enable_if_t<detail::is_scalar_operand_v<Scalar>>>
+FREQUENCYPP_INLINE constexpr auto operator*(
+    const Scalar& lhs, const frequency_expression<Node>& rhs)
+{
+    return detail::make_expression(detail::expr_multiply<Node, Scalar>{rhs.node(), lhs});
+}
+
+template<typename Node,
+    typename Scalar,
+    typename = std::enable_if_t<detail::is_scalar_operand_v<Scalar>>>
+FREQUENCYPP_INLINE constexpr auto operator/(
+    const frequency_expression<Node>& lhs, const Scalar& rhs)
+{
+    return detail::make_expression(detail::expr_divide<Node, Scalar>{lhs.node(), rhs});
+}
+
+} // namespace frequencypp
+
+namespace frequencypp::expr {
+
+/// Begin an expression with frequency operand \p f
+///
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f first operand of the expression
+/// \return expression whose value is \p f
+template<typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto lazy(const frequency<Rep, Period>& f)
+{
+    return detail::make_expression(detail::expr_value<frequency<Rep, Period>>{f});
+}
+
+/// Begin an expression whose value at each index is the element of array \p p at that index
+///
+/// The array must outlive the expression and have an element for every index it is evaluated at.
+///
+/// \tparam Rep arithmetic type representing the number of ticks for the elements of \p p
+/// \tparam Period ratio representing the tick period for the elements of \p p
+/// \param p array of operands of the expression
+/// \return expression whose value at each index is an element of \p p
+template<typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto each(const frequency<Rep, Period>* p)
+{
+    return detail::make_expression(detail::expr_span<frequency<Rep, Period>>{p});
+}
+
+/// Evaluate expression \p e, which must not have array operands
+///
+/// \tparam Node type of the root of \p e
+/// \param e expression to evaluate
+/// \return value of \p e
+template<typename Node>
+FREQUENCYPP_INLINE constexpr auto evaluate(const frequency_expression<Node>& e) ->
+    typename frequency_expression<Node>::result_type
+{
+    return e[0];
+}
+
+/// Evaluate expression \p e at each of the \p n indices of its array operands, storing the values
+/// in \p out
+///
+/// \tparam Node type of the root of \p e
+/// \param e expression to evaluate
+/// \param out array to store the values in
+/// \param n number of values to evaluate
+template<typename Node>
+FREQUENCYPP_INLINE constexpr auto evaluate(const frequency_expression<Node>& e,
+    typename frequency_expression<Node>::result_type* out,
+    std::size_t n) -> void
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = e[i];
+    }
+}
+
+} // namespace frequencypp::expr
+
+#endif // FREQUENCYPP_EXPRESSION_HPP
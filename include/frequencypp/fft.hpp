@@ -0,0 +1,552 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the real-input fast Fourier transform \ref frequencypp::fft_plan, whose spectra map
+/// bins to frequencies exactly
+
+#ifndef FREQUENCYPP_FFT_HPP
+#define FREQUENCYPP_FFT_HPP
+
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+#include <vector>
+
+#include <frequencypp/frequency_core.hpp>
+#include <frequencypp/simd.hpp>
+
+namespace frequencypp::detail {
+
+constexpr auto is_power_of_two(std::size_t n) noexcept -> bool
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+constexpr auto log2(std::size_t n) noexcept -> int
+{
+    auto bits = 0;
+    while (n > 1) {
+        n >>= 1;
+        ++bits;
+    }
+    return bits;
+}
+
+/// Forward transform twiddle factor e^(-2 pi i k / n)
+template<typename T>
+auto twiddle(std::size_t k, std::size_t n) -> std::complex<T>
+{
+    constexpr auto tau = 6.283185307179586476925286766559L;
+    const auto angle = -tau * static_cast<long double>(k) / static_cast<long double>(n);
+    return {static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+}
+
+/// One pass over the complex transform, combining blocks of \c half points into blocks of twice
+/// that, or of four times that if the pass is radix 4
+///
+/// The twiddle factors of each pass are stored contiguously with the real and imaginary parts in
+/// separate arrays, so that consecutive butterflies load them as vectors.
+template<typename T>
+struct fft_pass
+{
+    std::size_t half;
+    bool radix4;
+    std::vector<T> w1_re;
+    std::vector<T> w1_im;
+    std::vector<T> w2_re;
+    std::vector<T> w2_im;
+};
+
+/// Permutation and twiddle factors of the real-input transform of \p N samples, which is computed
+/// as a complex transform of \p N / 2 points
+template<typename T, std::size_t N>
+struct fft_tables
+{
+    static constexpr auto points = N / 2;
+
+    std::vector<std::uint32_t> reverse;
+    std::vector<fft_pass<T>> passes;
+    std::vector<T> post_re;
+    std::vector<T> post_im;
+
+    fft_tables()
+        : reverse(points)
+        , post_re(points + 1)
+        , post_im(points + 1)
+    {
+        const auto bits = log2(points);
+        for (std::size_t i = 0; i < points; ++i) {
+            auto r = std::size_t{0};
+            for (auto b = 0; b < bits; ++b) {
+                r |= ((i >> b) & 1U) << (bits - 1 - b);
+            }
+            reverse[i] = static_cast<std::uint32_t>(r);
+        }
+
+        // Radix-4 passes each fuse two radix-2 passes, with one radix-2 pass first if the number
+        // of radix-2 passes is odd
+        auto half = std::size_t{1};
+        if (bits % 2 == 1) {
+            passes.push_back({1, false, {T{1}}, {T{0}}, {}, {}});
+            half = 2;
+        }
+        for (; half < points; half *= 4) {
+            auto pass = fft_pass<T>{half, true, {}, {}, {}, {}};
+            for (std::size_t k = 0; k < half; ++k) {
+                const auto w1 = twiddle<T>(k, 2 * half);
+                const auto w2 = twiddle<T>(k, 4 * half);
+                pass.w1_re.push_back(w1.real());
+                pass.w1_im.push_back(w1.imag());
+                pass.w2_re.push_back(w2.real());
+                pass.w2_im.push_back(w2.imag());
+            }
+            passes.push_back(pass);
+        }
+
+        for (std::size_t k = 0; k <= points; ++k) {
+            const auto w = twiddle<T>(k, N);
+            post_re[k] = w.real();
+            post_im[k] = w.imag();
+        }
+    }
+
+    /// Get the tables for \p N samples, which are computed on first use and shared by every plan
+    static auto get() -> const fft_tables&
+    {
+        static const auto tables = fft_tables{};
+        return tables;
+    }
+};
+
+/// Vector of the lanes of type \p T that fit in a 128-bit register, which every target with vector
+/// extensions provides, or \p T itself if vectors of \p T are unavailable
+template<typename T, typename = void>
+struct fft_vector
+{
+    using type = T;
+};
+
+#if FREQUENCYPP_HAS_SIMD
+template<typename T>
+struct fft_vector<T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+{
+    using type = simd<T, 16 / sizeof(T)>;
+};
+#endif
+
+template<typename V>
+constexpr std::size_t fft_lanes = 1;
+
+#if FREQUENCYPP_HAS_SIMD
+template<typename T, std::size_t L>
+constexpr std::size_t fft_lanes<simd<T, L>> = L;
+#endif
+
+template<typename V, typename T>
+auto fft_load(const T* p) -> V
+{
+    if constexpr (std::is_same_v<V, T>) {
+        return *p;
+    }
+    else {
+        auto v = V{};
+        v.copy_from(p);
+        return v;
+    }
+}
+
+template<typename V, typename T>
+auto fft_store(T* p, const V& v) -> void
+{
+    if constexpr (std::is_same_v<V, T>) {
+        *p = v;
+    }
+    else {
+        v.copy_to(p);
+    }
+}
+
+/// Apply radix-2 pass \p pass to the \p n points of \p re and \p im, \p V holding the real or
+/// imaginary parts of consecutive butterflies
+template<typename V, typename T>
+auto fft_radix2(T* re, T* im, std::size_t n, const fft_pass<T>& pass) -> void
+{
+    const auto h = pass.half;
+    for (std::size_t j = 0; j < n; j += 2 * h) {
+        for (std::size_t k = 0; k < h; k += fft_lanes<V>) {
+            const auto a = j + k;
+            const auto b = a + h;
+            const auto wr = fft_load<V>(&pass.w1_re[k]);
+            const auto wi = fft_load<V>(&pass.w1_im[k]);
+            const auto ar = fft_load<V>(re + a);
+            const auto ai = fft_load<V>(im + a);
+            const auto br = fft_load<V>(re + b);
+            const auto bi = fft_load<V>(im + b);
+            const auto tr = V{br * wr - bi * wi};
+            const auto ti = V{br * wi + bi * wr};
+            fft_store<V>(re + a, V{ar + tr});
+            fft_store<V>(im + a, V{ai + ti});
+            fft_store<V>(re + b, V{ar - tr});
+            fft_store<V>(im + b, V{ai - ti});
+        }
+    }
+}
+
+/// Apply radix-4 pass \p pass to the \p n points of \p re and \p im, \p V holding the real or
+/// imaginary parts of consecutive butterflies
+///
+/// Each butterfly performs the two radix-2 passes of distances \c half and twice that on four
+/// points, so the points are loaded and stored once for both.
+template<typename V, typename T>
+auto fft_radix4(T* re, T* im, std::size_t n, const fft_pass<T>& pass) -> void
+{
+    const auto h = pass.half;
+    for (std::size_t j = 0; j < n; j += 4 * h) {
+        for (std::size_t k = 0; k < h; k += fft_lanes<V>) {
+            const auto a = j + k;
+            const auto b = a + h;
+            const auto c = b + h;
+            const auto d = c + h;
+            const auto w1r = fft_load<V>(&pass.w1_re[k]);
+            const auto w1i = fft_load<V>(&pass.w1_im[k]);
+            const auto w2r = fft_load<V>(&pass.w2_re[k]);
+            const auto w2i = fft_load<V>(&pass.w2_im[k]);
+            const auto ar = fft_load<V>(re + a);
+            const auto ai = fft_load<V>(im + a);
+            const auto br = fft_load<V>(re + b);
+            const auto bi = fft_load<V>(im + b);
+            const auto cr = fft_load<V>(re + c);
+            const auto ci = fft_load<V>(im + c);
+            const auto dr = fft_load<V>(re + d);
+            const auto di = fft_load<V>(im + d);
+
+            // First radix-2 pass, on (a, b) and (c, d) with twiddle w1
+            const auto tbr = V{br * w1r - bi * w1i};
+            const auto tbi = V{br * w1i + bi * w1r};
+            const auto tdr = V{dr * w1r - di * w1i};
+            const auto tdi = V{dr * w1i + di * w1r};
+            const auto a1r = V{ar + tbr};
+            const auto a1i = V{ai + tbi};
+            const auto b1r = V{ar - tbr};
+            const auto b1i = V{ai - tbi};
+            const auto c1r = V{cr + tdr};
+            const auto c1i = V{ci + tdi};
+            const auto d1r = V{cr - tdr};
+            const auto d1i = V{ci - tdi};
+
+            // Second radix-2 pass, on (a, c) with twiddle w2 and on (b, d) with twiddle -i * w2
+            const auto tcr = V{c1r * w2r - c1i * w2i};
+            const auto tci = V{c1r * w2i + c1i * w2r};
+            const auto tdr2 = V{d1r * w2i + d1i * w2r};
+            const auto tdi2 = V{d1i * w2i - d1r * w2r};
+            fft_store<V>(re + a, V{a1r + tcr});
+            fft_store<V>(im + a, V{a1i + tci});
+            fft_store<V>(re + c, V{a1r - tcr});
+            fft_store<V>(im + c, V{a1i - tci});
+            fft_store<V>(re + b, V{b1r + tdr2});
+            fft_store<V>(im + b, V{b1i + tdi2});
+            fft_store<V>(re + d, V{b1r - tdr2});
+            fft_store<V>(im + d, V{b1i - tdi2});
+        }
+    }
+}
+
+/// Compute the complex transform of the \p n bit-reversed points of \p re and \p im in place
+template<typename T>
+auto fft_complex(T* re, T* im, std::size_t n, const std::vector<fft_pass<T>>& passes) -> void
+{
+    using vector = typename fft_vector<T>::type;
+    for (const auto& pass : passes) {
+        // Passes over blocks narrower than a vector run one butterfly at a time
+        const auto wide = pass.half >= fft_lanes<vector>;
+        if (pass.radix4) {
+            if (wide) {
+                fft_radix4<vector>(re, im, n, pass);
+            }
+            else {
+                fft_radix4<T>(re, im, n, pass);
+            }
+        }
+        else {
+            if (wide) {
+                fft_radix2<vector>(re, im, n, pass);
+            }
+            else {
+                fft_radix2<T>(re, im, n, pass);
+            }
+        }
+    }
+}
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+template<std::size_t N, typename Rep, typename Period, typename T>
+class fft_plan;
+
+/// Spectrum of a real signal, whose bins are tagged with their frequencies
+///
+/// The bins are spaced by the sample rate divided by the number of samples, which \p BinFrequency
+/// represents exactly: its period is that of the sample rate divided by the number of samples, so
+/// that the centre frequency of every bin is an integral tick count.
+///
+/// \tparam T floating-point type of the real and imaginary parts of the bins
+/// \tparam BinFrequency \ref frequencypp::frequency type of the bin frequencies
+template<typename T, typename BinFrequency>
+class spectrum
+{
+    template<std::size_t, typename, typename, typename>
+    friend class fft_plan;
+
+    std::vector<std::complex<T>> bins_;
+    BinFrequency resolution_{};
+    // Workspace of the transform, kept so that transforming into this spectrum again is free of
+    // allocation
+    std::vector<T> re_;
+    std::vector<T> im_;
+
+public:
+    /// Type of the bins
+    using value_type = std::complex<T>;
+    /// \ref frequencypp::frequency type of the bin frequencies
+    using frequency_type = BinFrequency;
+    /// Iterator over the bins
+    using const_iterator = typename std::vector<std::complex<T>>::const_iterator;
+
+    /// Get the number of bins, which is one more than half the number of samples
+    ///
+    /// \return number of bins
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return bins_.size();
+    }
+
+    /// Get bin \p k, whose magnitude is the amplitude times half the number of samples
+    ///
+    /// \param k index of the bin
+    /// \return bin \p k
+    auto operator[](std::size_t k) const -> const std::complex<T>&
+    {
+        return bins_[k];
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator
+    {
+        return bins_.begin();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator
+    {
+        return bins_.end();
+    }
+
+    /// Get the magnitude of bin \p k
+    ///
+    /// \param k index of the bin
+    /// \return magnitude of bin \p k
+    [[nodiscard]] auto magnitude(std::size_t k) const -> T
+    {
+        return std::abs(bins_[k]);
+    }
+
+    /// Get the spacing of the bins, which is the sample rate divided by the number of samples
+    ///
+    /// \return spacing of the bins
+    [[nodiscard]] auto resolution() const noexcept -> BinFrequency
+    {
+        return resolution_;
+    }
+
+    /// Get the centre frequency of bin \p k
+    ///
+    /// \param k index of the bin
+    /// \return centre frequency of bin \p k
+    [[nodiscard]] auto bin_frequency(std::size_t k) const -> BinFrequency
+    {
+        using rep = typename BinFrequency::rep;
+        return BinFrequency{static_cast<rep>(resolution_.count() * static_cast<rep>(k))};
+    }
+
+    /// Get the index of the bin whose centre frequency is nearest to \p f, rounding halfway cases
+    /// up
+    ///
+    /// The division is exact, done on the tick counts of the common type of \p f and the bin
+    /// frequencies.  Frequencies beyond the range of the bins map to the first or last bin.
+    ///
+    /// \tparam Rep arithmetic type representing the number of ticks for \p f
+    /// \tparam Period ratio representing the tick period for \p f
+    /// \param f frequency to find the bin of
+    /// \return index of the bin nearest to \p f
+    template<typename Rep, typename Period>
+    [[nodiscard]] auto nearest_bin(const frequency<Rep, Period>& f) const -> std::size_t
+    {
+        using ct = std::common_type_t<BinFrequency, frequency<Rep, Period>>;
+        const auto fc = ct{f}.count();
+        const auto rc = ct{resolution_}.count();
+        if (!(fc > 0)) {
+            return 0;
+        }
+        auto k = std::size_t{0};
+        if constexpr (std::chrono::treat_as_floating_point_v<typename ct::rep>) {
+            k = static_cast<std::size_t>(std::floor(fc / rc + 0.5));
+        }
+        else {
+            k = static_cast<std::size_t>((fc + fc + rc) / (rc + rc));
+        }
+        return k < size() ? k : size() - 1;
+    }
+};
+
+/// Plan for the fast Fourier transform of \p N real samples taken at a given sample rate
+///
+/// The transform of \p N real samples is computed as a complex transform of \p N / 2 points
+/// followed by a pass that separates the spectra of the even and odd samples.  The complex
+/// transform runs radix-4 passes, each fusing two radix-2 passes, with the real and imaginary
+/// parts in separate arrays, so that consecutive butterflies run in the lanes of a \ref
+/// frequencypp::simd vector where vector extensions are available.  The permutation and twiddle
+/// factors depend only on \p N and \p T; they are computed when the first plan of that size is
+/// constructed and shared by every later plan.
+///
+/// \tparam N number of samples, which must be a power of two
+/// \tparam Rep arithmetic type representing the number of ticks of the sample rate
+/// \tparam Period ratio representing the tick period of the sample rate
+/// \tparam T floating-point type of the samples and bins
+template<std::size_t N, typename Rep, typename Period, typename T = double>
+class fft_plan
+{
+    static_assert(detail::is_power_of_two(N) && N >= 2, "N must be a power of two of at least 2");
+    static_assert(std::is_floating_point_v<T>, "T must be a floating-point type");
+
+    using tables = detail::fft_tables<T, N>;
+
+public:
+    /// \ref frequencypp::frequency type of the sample rate
+    using sample_rate_type = frequency<Rep, Period>;
+    /// \ref frequencypp::frequency type of the bin frequencies, whose period is that of the sample
+    /// rate divided by \p N
+    using bin_frequency_type = frequency<Rep,
+        typename std::ratio_divide<Period, std::ratio<static_cast<std::intmax_t>(N)>>::type>;
+    /// Spectrum type produced by the transform
+    using spectrum_type = spectrum<T, bin_frequency_type>;
+
+private:
+    sample_rate_type rate_;
+    const tables* tables_;
+
+public:
+    /// Construct a plan for samples taken at \p sample_rate
+    ///
+    /// \param sample_rate rate at which the samples are taken
+    explicit fft_plan(const sample_rate_type& sample_rate)
+        : rate_(sample_rate)
+        , tables_(&tables::get())
+    {}
+
+    /// Get the number of samples
+    ///
+    /// \return number of samples
+    static constexpr auto size() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    /// Get the sample rate
+    ///
+    /// \return sample rate
+    [[nodiscard]] auto sample_rate() const noexcept -> sample_rate_type
+    {
+        return rate_;
+    }
+
+    /// Get the spacing of the bins, which is the sample rate divided by \p N
+    ///
+    /// \return spacing of the bins
+    [[nodiscard]] auto resolution() const noexcept -> bin_frequency_type
+    {
+        return bin_frequency_type{rate_.count()};
+    }
+
+    /// Transform the \p N samples of \p samples
+    ///
+    /// \param samples samples to transform
+    /// \return spectrum of \p samples
+    auto operator()(const T* samples) const -> spectrum_type
+    {
+        auto s = spectrum_type{};
+        transform(samples, s);
+        return s;
+    }
+
+    /// Transform the \p N samples of \p samples into spectrum \p out, reusing its storage
+    ///
+    /// \param samples samples to transform
+    /// \param out spectrum to store the result in
+    auto transform(const T* samples, spectrum_type& out) const -> void
+    {
+        constexpr auto points = tables::points;
+        out.bins_.resize(points + 1);
+        out.re_.resize(points);
+        out.im_.resize(points);
+        out.resolution_ = resolution();
+        auto* re = out.re_.data();
+        auto* im = out.im_.data();
+
+        // Pack even samples as real parts and odd samples as imaginary parts, in bit-reversed order
+        for (std::size_t i = 0; i < points; ++i) {
+            re[tables_->reverse[i]] = samples[2 * i];
+            im[tables_->reverse[i]] = samples[2 * i + 1];
+        }
+        detail::fft_complex(re, im, points, tables_->passes);
+
+        // Separate the spectra of the even and odd samples, E and O, from the packed spectrum Z:
+        // E[k] = (Z[k] + conj(Z[-k])) / 2, O[k] = -i (Z[k] - conj(Z[-k])) / 2, and
+        // X[k] = E[k] + e^(-2 pi i k / N) O[k]
+        for (std::size_t k = 0; k <= points; ++k) {
+            const auto a = k % points;
+            const auto b = (points - k) % points;
+            const auto even_re = (re[a] + re[b]) / 2;
+            const auto even_im = (im[a] - im[b]) / 2;
+            const auto odd_re = (im[a] + im[b]) / 2;
+            const auto odd_im = (re[b] - re[a]) / 2;
+            const auto wr = tables_->post_re[k];
+            const auto wi = tables_->post_im[k];
+            out.bins_[k] = {
+                even_re + wr * odd_re - wi * odd_im, even_im + wr * odd_im + wi * odd_re};
+        }
+    }
+};
+
+/// Create a plan for the fast Fourier transform of \p N real samples taken at \p sample_rate
+///
+/// \tparam N number of samples, which must be a power of two
+/// \tparam T floating-point type of the samples and bins
+/// \tparam Rep arithmetic type representing the number of ticks of \p sample_rate
+/// \tparam Period ratio representing the tick period of \p sample_rate
+/// \param sample_rate rate at which the samples are taken
+/// \return plan for the transform
+template<std::size_t N, typename T = double, typename Rep, typename Period>
+auto make_fft_plan(const frequency<Rep, Period>& sample_rate) -> fft_plan<N, Rep, Period, T>
+{
+    return fft_plan<N, Rep, Period, T>{sample_rate};
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_FFT_HPP
@@ -0,0 +1,1136 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the temporal frequency type \ref frequencypp::frequency and its casts, arithmetic,
+/// comparisons, and literals, without the stream operators of \ref frequency_io.hpp
+
+#ifndef FREQUENCYPP_FREQUENCY_CORE_HPP
+#define FREQUENCYPP_FREQUENCY_CORE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include <frequencypp/detail/attributes.hpp>
+#include <frequencypp/detail/int128.hpp>
+#include <frequencypp/frequency_fwd.hpp>
+
+// Types needed to implement frequency, which may refer to the forward declarations
+
+namespace frequencypp::detail {
+
+template<typename T>
+struct is_frequency : std::false_type
+{};
+
+template<typename Rep, typename Period>
+struct is_frequency<frequency<Rep, Period>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_frequency_v = is_frequency<T>::value;
+
+template<typename T>
+struct is_duration : std::false_type
+{};
+
+template<typename Rep, typename Period>
+struct is_duration<std::chrono::duration<Rep, Period>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_duration_v = is_duration<T>::value;
+
+template<typename T>
+struct is_ratio : std::false_type
+{};
+
+template<std::intmax_t Num, std::intmax_t Den>
+struct is_ratio<std::ratio<Num, Den>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_ratio_v = is_ratio<T>::value;
+
+/// Greatest common divisor of \p a and \p b, which avoids including \c <numeric> for \c std::gcd
+constexpr auto gcd(std::intmax_t a, std::intmax_t b) noexcept -> std::intmax_t
+{
+    a = a < 0 ? -a : a;
+    b = b < 0 ? -b : b;
+    while (b != 0) {
+        const auto r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/// Whether ratio \p R1 is an integral multiple of ratio \p R2
+///
+/// The reduced quotient has a denominator of one exactly when these divisions are exact, which
+/// avoids forming the quotient as a \c std::ratio that may not be representable.
+template<typename R1, typename R2>
+constexpr bool is_ratio_multiple_v = R2::den % R1::den == 0 && R1::num % R2::num == 0;
+
+/// Product of ratios \p R1 and \p R2 as a numerator and denominator of type \p Rep
+///
+/// \c std::ratio is limited to \c std::intmax_t, so for 128-bit representations the product is
+/// computed in \p Rep instead, which allows conversions such as nanohertz to terahertz whose
+/// scale exceeds 64 bits.
+template<typename Rep, typename R1, typename R2, bool Wide = is_int128_v<Rep>>
+struct scale_ratio
+{
+    using type = std::ratio_multiply<R1, R2>;
+    static constexpr auto num = static_cast<Rep>(type::num);
+    static constexpr auto den = static_cast<Rep>(type::den);
+};
+
+template<typename Rep, typename R1, typename R2>
+struct scale_ratio<Rep, R1, R2, true>
+{
+    static constexpr auto gcd1 = gcd(R1::num, R2::den);
+    static constexpr auto gcd2 = gcd(R2::num, R1::den);
+    static constexpr auto num = static_cast<Rep>(R1::num / gcd1) * static_cast<Rep>(R2::num / gcd2);
+    static constexpr auto den = static_cast<Rep>(R1::den / gcd2) * static_cast<Rep>(R2::den / gcd1);
+};
+
+/// Common tick count type of \p Rep1 and \p Rep2, widened to at least \c std::int64_t if it is
+/// an integral type that is narrower and \p Scaled, the counts being converted to a finer period
+///
+/// Narrow counts such as those of \ref frequencypp::narrow_literals would otherwise overflow in
+/// the conversion, as \c 1_KHz + \c 1_Hz does in \c std::int8_t.
+template<typename Rep1, typename Rep2, bool Scaled, typename Rep = std::common_type_t<Rep1, Rep2>>
+using common_rep_t = std::conditional_t<Scaled && std::is_integral_v<Rep>
+        && (sizeof(Rep) < sizeof(std::int64_t)),
+    std::common_type_t<Rep, std::int64_t>,
+    Rep>;
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::common_type for \ref frequencypp::frequency
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+struct std::common_type<frequencypp::frequency<Rep1, Period1>,
+    frequencypp::frequency<Rep2, Period2>>
+{
+private:
+    static constexpr auto gcd_num = frequencypp::detail::gcd(Period1::num, Period2::num);
+    static constexpr auto gcd_den = frequencypp::detail::gcd(Period1::den, Period2::den);
+    using period = std::ratio<gcd_num, Period1::den / gcd_den * Period2::den>;
+    static constexpr auto scaled = !std::ratio_equal_v<period, Period1>
+        || !std::ratio_equal_v<period, Period2>;
+
+public:
+    /// Common type of two \ref frequencypp::frequency types, whose period is the greatest common
+    /// divisor of \p Period1 and \p Period2, and whose tick count is wide enough for a narrow
+    /// integral count to be converted to that period
+    using type = frequencypp::frequency<frequencypp::detail::common_rep_t<Rep1, Rep2, scaled>,
+        typename period::type>;
+};
+
+/// Specialization of std::common_type for two identical \ref frequencypp::frequency types
+template<typename Rep, typename Period>
+struct std::common_type<frequencypp::frequency<Rep, Period>>
+{
+    /// Common type of two identical \ref frequencypp::frequency types
+    using type = frequencypp::frequency<std::common_type_t<Rep>, typename Period::type>;
+};
+
+namespace frequencypp {
+
+/// Defines three common frequencies that can be specialized for a given \p Rep if the
+/// representation requires specific values
+///
+/// The \ref frequencypp::frequency::zero, \ref frequencypp::frequency::min, and
+/// \ref frequencypp::frequency::max methods forward their work to these methods.
+///
+/// \tparam Rep arithmetic type representing the number of ticks
+template<typename Rep>
+struct frequency_values
+{
+    /// Gets the zero-length representation
+    ///
+    /// \return zero-length representation
+    FREQUENCYPP_INLINE static constexpr auto zero() noexcept -> Rep
+    {
+        return Rep{0};
+    }
+
+    /// Gets the smallest possible representation
+    ///
+    /// \return smallest possible representation
+    FREQUENCYPP_INLINE static constexpr auto min() noexcept -> Rep
+    {
+        return std::numeric_limits<Rep>::lowest();
+    }
+
+    /// Gets the largest possible representation
+    ///
+    /// \return largest possible representation
+    FREQUENCYPP_INLINE static constexpr auto max() noexcept -> Rep
+    {
+        return std::numeric_limits<Rep>::max();
+    }
+};
+
+/// Chooses between two tick counts according to the result of a comparison of type \p Mask, which
+/// can be specialized for a \p Mask other than \c bool
+///
+/// Comparisons of frequencies return whatever comparisons of their representations return, which
+/// is a mask of lanes rather than \c bool for vector representations.  \ref frequencypp::floor,
+/// \ref frequencypp::ceil, \ref frequencypp::round, and \ref frequencypp::abs choose between
+/// candidate results using this selection instead of branching, so that they apply lane-wise.
+///
+/// \tparam Mask type of the result of comparing representations
+template<typename Mask>
+struct frequency_select
+{
+    /// Chooses \p a if \p m is set, otherwise \p b
+    ///
+    /// \tparam Rep arithmetic type representing the number of ticks
+    /// \param m comparison result
+    /// \param a tick count to choose if \p m is set
+    /// \param b tick count to choose if \p m is not set
+    /// \return \p a or \p b
+    template<typename Rep>
+    FREQUENCYPP_INLINE static constexpr auto select(const Mask& m, const Rep& a, const Rep& b)
+        -> Rep
+    {
+        return m ? a : b;
+    }
+};
+
+/// Convert a \ref frequencypp::frequency to a frequency of different type \p ToFrequency
+///
+/// No implicit conversions are used.  Computations are done in the widest type available and
+/// converted, as if by \c static_cast, to the result type only when finished.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return \p f converted to a frequency of type \p ToFrequency
+template<typename ToFrequency, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto frequency_cast(const frequency<Rep, Period>& f)
+    -> std::enable_if_t<detail::is_frequency_v<ToFrequency>, ToFrequency>
+{
+    using to_rep = typename ToFrequency::rep;
+    using to_period = typename ToFrequency::period;
+    using common_rep = std::common_type_t<Rep, to_rep, std::intmax_t>;
+    using scale =
+        detail::scale_ratio<common_rep, Period, std::ratio<to_period::den, to_period::num>>;
+    // Zero needs no special case, as it scales to zero
+    return ToFrequency{
+        static_cast<to_rep>(static_cast<common_rep>(f.count()) * scale::num / scale::den)};
+}
+
+/// Convert a \c std::chrono::duration to the equivalent frequency type \p ToFrequency
+///
+/// No implicit conversions are used.  Computations are done in the widest type available and
+/// converted, as if by \c static_cast, to the result type only when finished.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p d
+/// \tparam Period ratio representing the tick period for \p d
+/// \param d duration to convert
+/// \return \p d converted to a frequency of type \p ToFrequency
+template<typename ToFrequency, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto frequency_cast(const std::chrono::duration<Rep, Period>& d)
+    -> std::enable_if_t<detail::is_frequency_v<ToFrequency>, ToFrequency>
+{
+    using to_rep = typename ToFrequency::rep;
+    using to_period = typename ToFrequency::period;
+    using common_rep = std::common_type_t<Rep, to_rep, std::intmax_t>;
+    using scale = detail::scale_ratio<common_rep, Period, to_period>;
+    // Zero has no reciprocal and converts to zero, by way of the count so that a representation
+    // such as \ref frequencypp::checked keeps the state it carries
+    if (!d.count()) {
+        return ToFrequency{static_cast<to_rep>(static_cast<common_rep>(d.count()))};
+    }
+    return ToFrequency{
+        static_cast<to_rep>(scale::den / (scale::num * static_cast<common_rep>(d.count())))};
+}
+
+/// Convert a \ref frequencypp::frequency to the equivalent duration type \p ToDuration
+///
+/// No implicit conversions are used.  Computations are done in the widest type available and
+/// converted, as if by \c static_cast, to the result type only when finished.
+///
+/// \tparam ToDuration \c std::chrono::duration type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return \p f converted to a duration of type \p ToDuration
+template<typename ToDuration, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto duration_cast(const frequency<Rep, Period>& f)
+    -> std::enable_if_t<detail::is_duration_v<ToDuration>, ToDuration>
+{
+    using to_rep = typename ToDuration::rep;
+    using to_period = typename ToDuration::period;
+    using common_rep = std::common_type_t<Rep, to_rep, std::intmax_t>;
+    using scale = detail::scale_ratio<common_rep, Period, to_period>;
+    // Zero has no reciprocal and converts to zero, by way of the count so that a representation
+    // such as \ref frequencypp::checked keeps the state it carries
+    if (!f.count()) {
+        return ToDuration{static_cast<to_rep>(static_cast<common_rep>(f.count()))};
+    }
+    return ToDuration{
+        static_cast<to_rep>(scale::den / (scale::num * static_cast<common_rep>(f.count())))};
+}
+
+/// Represents a temporal frequency
+///
+/// A frequency consists of a count of ticks of type \p Rep and a tick period \p Period, where the
+/// tick period is a compile-time rational fraction representing the frequency in hertz from one
+/// tick to the next.
+///
+/// The only data stored in a \ref frequencypp::frequency is a tick count of type \p Rep.  If \p Rep
+/// is floating point, then the \ref frequencypp::frequency can represent fractions of ticks.
+/// \p Period is included as part of the type and is only used when converting between different
+/// frequencies.
+///
+/// \tparam Rep arithmetic type representing the number of ticks
+/// \tparam Period ratio representing the tick period
+template<typename Rep, typename Period>
+struct frequency
+{
+    using rep_values = frequency_values<Rep>;
+
+    Rep count_;
+
+public:
+    /// Arithmetic type representing the number of ticks
+    using rep = Rep;
+    /// Ratio representing the tick period (i.e. the number of hertz fractions per tick)
+    using period = typename Period::type;
+
+    static_assert(!detail::is_frequency_v<rep>, "rep cannot be a frequency");
+    static_assert(detail::is_ratio_v<period>, "period must be a ratio");
+    static_assert(period::num > 0, "period must be positive");
+
+    /// Default-construct the frequency
+    constexpr frequency() = default;
+
+    /// Copy-construct the frequency
+    constexpr frequency(const frequency&) = default;
+
+    /// Move-construct the frequency
+    constexpr frequency(frequency&&) noexcept = default;
+
+    /// Construct the frequency with \p r ticks
+    ///
+    /// \tparam Rep2 arithmetic type representing the number of ticks
+    /// \param r tick count
+    template<typename Rep2,
+        typename = std::enable_if_t<
+            std::is_convertible_v<const Rep2&,
+                rep> && (std::chrono::treat_as_floating_point_v<rep> || !std::chrono::treat_as_floating_point_v<Rep2>)>>
+    FREQUENCYPP_INLINE constexpr explicit frequency(const Rep2& r)
+        : count_(static_cast<rep>(r))
+    {}
+
+    /// Construct the frequency by converting \p f to an appropriate period and tick count, as if by
+    /// \p frequencypp::frequency_cast<frequency>(f).count()
+    ///
+    /// \tparam Rep2 arithmetic type representing the number of ticks
+    /// \tparam Period2 ratio representing the tick period
+    template<typename Rep2,
+        typename Period2,
+        typename = std::enable_if_t<
+            std::chrono::treat_as_floating_point_v<
+                rep> || (detail::is_ratio_multiple_v<Period2, period> && !std::chrono::treat_as_floating_point_v<Rep2>)>>
+    // Implicit conversions are desired for this constructor, as they enable arithmetic like
+    // -1_Hz + 2_KHz
+    // NOLINTNEXTLINE
+    FREQUENCYPP_INLINE constexpr frequency(const frequency<Rep2, Period2>& f)
+        : count_(frequency_cast<frequency>(f).count())
+    {}
+
+    /// Destruct the frequency
+    ~frequency() = default;
+
+    /// Copy-assign the frequency
+    constexpr auto operator=(const frequency&) -> frequency& = default;
+
+    /// Move-assign the frequency
+    constexpr auto operator=(frequency&&) noexcept -> frequency& = default;
+
+    /// Gets the zero-length frequency
+    ///
+    /// If the representation \p Rep of the frequency requires some other implementation to return a
+    /// zero-length frequency, \ref frequencypp::frequency_values can be specialized to return the
+    /// desired value.
+    ///
+    /// \return zero-length frequency
+    FREQUENCYPP_INLINE static constexpr auto zero() noexcept -> frequency
+    {
+        return frequency{rep_values::zero()};
+    }
+
+    /// Gets the smallest possible frequency
+    ///
+    /// If the representation \p Rep of the frequency requires some other implementation to return a
+    /// smallest possible frequency, \ref frequencypp::frequency_values can be specialized to return
+    /// the desired value.
+    ///
+    /// \return smallest possible frequency
+    FREQUENCYPP_INLINE static constexpr auto min() noexcept -> frequency
+    {
+        return frequency{rep_values::min()};
+    }
+
+    /// Gets the largest possible frequency
+    ///
+    /// If the representation \p Rep of the frequency requires some other implementation to return a
+    /// largest possible frequency, \ref frequencypp::frequency_values can be specialized to return
+    /// the desired value.
+    ///
+    /// \return largest possible frequency
+    FREQUENCYPP_INLINE static constexpr auto max() noexcept -> frequency
+    {
+        return frequency{rep_values::max()};
+    }
+
+    /// Get the number of ticks
+    ///
+    /// \return number of ticks
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto count() const -> rep
+    {
+        return count_;
+    }
+
+    /// Get the reinforcement of the frequency
+    ///
+    /// \return reinforcement of the frequency
+    FREQUENCYPP_INLINE constexpr auto operator+() const -> std::common_type_t<frequency>
+    {
+        return std::common_type_t<frequency>{*this};
+    }
+
+    /// Get the negation of the frequency
+    ///
+    /// \return negation of the frequency
+    FREQUENCYPP_INLINE constexpr auto operator-() const -> std::common_type_t<frequency>
+    {
+        return std::common_type_t<frequency>{-count_};
+    }
+
+    /// Increment the number of ticks for this frequency
+    ///
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator++() -> frequency&
+    {
+        ++count_;
+        return *this;
+    }
+
+    /// Increment the number of ticks for this frequency
+    ///
+    /// \return copy of this frequency before modification
+    FREQUENCYPP_INLINE constexpr auto operator++(int) -> frequency
+    {
+        return frequency{count_++};
+    }
+
+    /// Decrement the number of ticks for this frequency
+    ///
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator--() -> frequency&
+    {
+        --count_;
+        return *this;
+    }
+
+    /// Decrement the number of ticks for this frequency
+    ///
+    /// \return copy of this frequency before modification
+    FREQUENCYPP_INLINE constexpr auto operator--(int) -> frequency
+    {
+        return frequency{count_--};
+    }
+
+    /// Add the frequency \p rhs to this frequency
+    ///
+    /// \param rhs right-hand frequency to add
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator+=(const frequency& rhs) -> frequency&
+    {
+        count_ += rhs.count();
+        return *this;
+    }
+
+    /// Subtract the frequency \p rhs from this frequency
+    ///
+    /// \param rhs right-hand frequency to subtract
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator-=(const frequency& rhs) -> frequency&
+    {
+        count_ -= rhs.count();
+        return *this;
+    }
+
+    /// Multiply this frequency by factor \p rhs
+    ///
+    /// \param rhs right-hand factor to multiply by
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator*=(const rep& rhs) -> frequency&
+    {
+        count_ *= rhs;
+        return *this;
+    }
+
+    /// Divide this frequency by factor \p rhs
+    ///
+    /// \param rhs right-hand factor to divide by
+    /// \return reference to this frequency after modification
+    FREQUENCYPP_INLINE constexpr auto operator/=(const rep& rhs) -> frequency&
+    {
+        count_ /= rhs;
+        return *this;
+    }
+
+    /// Reduce this frequency by modulus \p rhs
+    ///
+    /// \param rhs right-hand modulus
+    /// \return reference to this frequency after modification
+    template<typename Rep2 = rep>
+    FREQUENCYPP_INLINE constexpr auto operator%=(const rep& rhs)
+        -> std::enable_if_t<!std::chrono::treat_as_floating_point_v<Rep2>, frequency&>
+    {
+        count_ %= rhs;
+        return *this;
+    }
+
+    /// Reduce this frequency by modulus \p rhs
+    ///
+    /// \param rhs right-hand modulus
+    /// \return reference to this frequency after modification
+    template<typename Rep2 = rep>
+    FREQUENCYPP_INLINE constexpr auto operator%=(const frequency& rhs)
+        -> std::enable_if_t<!std::chrono::treat_as_floating_point_v<Rep2>, frequency&>
+    {
+        count_ %= rhs.count();
+        return *this;
+    }
+};
+
+namespace detail {
+
+/// Result of comparing frequencies of types \p Frequency1 and \p Frequency2, which is the result of
+/// comparing tick counts of their common type
+template<typename Frequency1, typename Frequency2>
+using frequency_compare_t = decltype(
+    std::declval<const typename std::common_type_t<Frequency1, Frequency2>::rep&>()
+    < std::declval<const typename std::common_type_t<Frequency1, Frequency2>::rep&>());
+
+/// Choose frequency \p a where \p m is set and frequency \p b elsewhere
+template<typename Mask, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto select(const Mask& m,
+    const frequency<Rep, Period>& a,
+    const frequency<Rep, Period>& b) -> frequency<Rep, Period>
+{
+    return frequency<Rep, Period>{frequency_select<Mask>::select(m, a.count(), b.count())};
+}
+
+} // namespace detail
+
+// Comparison
+
+/// Determine whether the left-hand frequency \p lhs is equal to the right-hand frequency \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs and \p rhs represent the same frequency
+/// \retval false if \p lhs and \p rhs represent different frequencies
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator==(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{lhs}.count() == ct{rhs}.count();
+}
+
+/// Determine whether the left-hand frequency \p lhs is unequal to the right-hand frequency \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs and \p rhs represent different frequencies
+/// \retval false if \p lhs and \p rhs represent the same frequency
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator!=(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    return !(lhs == rhs);
+}
+
+/// Determine whether the left-hand frequency \p lhs is less frequent than the right-hand frequency
+/// \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs is less frequent than \p rhs
+/// \retval false if \p lhs is more frequent than or as frequent as \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator<(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{lhs}.count() < ct{rhs}.count();
+}
+
+/// Determine whether the left-hand frequency \p lhs is less frequent than or as frequent as the
+/// right-hand frequency \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs is less frequent than or as frequent as \p rhs
+/// \retval false if \p lhs is more frequent than \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator<=(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    return !(rhs < lhs);
+}
+
+/// Determine whether the left-hand frequency \p lhs is more frequent than the right-hand frequency
+/// \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs is more frequent than \p rhs
+/// \retval false if \p lhs is less frequent than or as frequent as \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator>(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    return rhs < lhs;
+}
+
+/// Determine whether the left-hand frequency \p lhs is more frequent than or as frequent as the
+/// right-hand frequency \p rhs
+///
+/// The comparison is made using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to compare
+/// \param rhs right-hand frequency to compare
+/// \retval true if \p lhs is more frequent than or as frequent as \p rhs
+/// \retval false if \p lhs is less frequent than \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator>=(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> detail::frequency_compare_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    return !(lhs < rhs);
+}
+
+// Arithmetic
+
+/// Add the tick count of frequency \p rhs to the tick count of frequency \p lhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to add
+/// \param rhs right-hand frequency to add
+/// \return frequency with the sum of the tick counts of \p lhs and \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator+(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{ct{lhs}.count() + ct{rhs}.count()};
+}
+
+/// Subtract the tick count of frequency \p rhs from the tick count of frequency \p lhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to subtract
+/// \param rhs right-hand frequency to subtract
+/// \return frequency with the difference of the tick counts of \p lhs and \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator-(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{ct{lhs}.count() - ct{rhs}.count()};
+}
+
+/// Multiply the tick count of frequency \p lhs by factor \p rhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \param lhs left-hand frequency to multiply
+/// \param rhs right-hand factor to multiply by
+/// \return frequency with the product of the tick count of \p lhs and \p rhs
+template<typename Rep1, typename Period, typename Rep2>
+FREQUENCYPP_INLINE constexpr auto operator*(const frequency<Rep1, Period>& lhs, const Rep2& rhs)
+    -> frequency<std::common_type_t<Rep1, Rep2>, Period>
+{
+    using ct = frequency<std::common_type_t<Rep1, Rep2>, Period>;
+    return ct{ct{lhs}.count() * rhs};
+}
+
+/// Multiply the tick count of frequency \p rhs by factor \p lhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period ratio representing the tick period for \p rhs
+/// \param lhs left-hand factor to multiply by
+/// \param rhs right-hand frequency to multiply
+/// \return frequency with the product of \p lhs and the tick count of \p rhs
+template<typename Rep1, typename Rep2, typename Period>
+FREQUENCYPP_INLINE constexpr auto operator*(const Rep1& lhs, const frequency<Rep2, Period>& rhs)
+    -> frequency<std::common_type_t<Rep1, Rep2>, Period>
+{
+    using ct = frequency<std::common_type_t<Rep1, Rep2>, Period>;
+    return ct{lhs * ct{rhs}.count()};
+}
+
+/// Calculate the number of cycles at frequency \p rhs that occur in duration \p lhs
+///
+/// The calculation is done using the common type of \p Rep1 and \p Rep2.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand duration to multiply
+/// \param rhs right-hand frequency to multiply
+/// \return number of cycles at frequency \p rhs that occur in duration \p lhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator*(const std::chrono::duration<Rep1, Period1>& lhs,
+    const frequency<Rep2, Period2>& rhs) -> std::common_type_t<Rep1, Rep2>
+{
+    using common_rep = std::common_type_t<Rep1, Rep2>;
+    using scale = detail::scale_ratio<common_rep, Period1, Period2>;
+    return (scale::num * static_cast<common_rep>(lhs.count())
+               * static_cast<common_rep>(rhs.count()))
+        / scale::den;
+}
+
+/// Calculate the number of cycles at frequency \p lhs that occur in duration \p rhs
+///
+/// The calculation is done using the common type of \p Rep1 and \p Rep2.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to multiply
+/// \param rhs right-hand duration to multiply
+/// \return number of cycles at frequency \p lhs that occur in duration \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator*(const frequency<Rep1, Period1>& lhs,
+    const std::chrono::duration<Rep2, Period2>& rhs) -> std::common_type_t<Rep1, Rep2>
+{
+    using common_rep = std::common_type_t<Rep1, Rep2>;
+    using scale = detail::scale_ratio<common_rep, Period1, Period2>;
+    return (scale::num * static_cast<common_rep>(lhs.count())
+               * static_cast<common_rep>(rhs.count()))
+        / scale::den;
+}
+
+/// Divide the tick count of frequency \p lhs by factor \p rhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \param lhs left-hand frequency to divide
+/// \param rhs right-hand factor to divide by
+/// \return frequency with the quotient of the tick count of \p lhs and \p rhs
+template<typename Rep1, typename Period, typename Rep2>
+FREQUENCYPP_INLINE constexpr auto operator/(const frequency<Rep1, Period>& lhs, const Rep2& rhs)
+    -> frequency<std::common_type_t<Rep1, Rep2>, Period>
+{
+    using ct = frequency<std::common_type_t<Rep1, Rep2>, Period>;
+    return ct{ct{lhs}.count() / rhs};
+}
+
+/// Divide the tick count of frequency \p rhs by the tick count of frequency \p lhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to divide
+/// \param rhs right-hand frequency to divide by
+/// \return quotient of the tick counts of \p lhs and \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator/(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> std::common_type_t<Rep1, Rep2>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{lhs}.count() / ct{rhs}.count();
+}
+
+/// Reduce the tick count of frequency \p lhs by modulus \p rhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \param lhs left-hand frequency to reduce
+/// \param rhs right-hand modulus to reduce by
+/// \return frequency with the remainder of the tick count of \p lhs and \p rhs
+template<typename Rep1, typename Period, typename Rep2>
+FREQUENCYPP_INLINE constexpr auto operator%(const frequency<Rep1, Period>& lhs, const Rep2& rhs)
+    -> frequency<std::common_type_t<Rep1, Rep2>, Period>
+{
+    using ct = frequency<std::common_type_t<Rep1, Rep2>, Period>;
+    return ct{ct{lhs}.count() % rhs};
+}
+
+/// Modulo the tick count of frequency \p rhs by the tick count of frequency \p lhs
+///
+/// The calculation is done using the common type of \p lhs and \p rhs.
+///
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p lhs
+/// \tparam Period1 ratio representing the tick period for \p lhs
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p rhs
+/// \tparam Period2 ratio representing the tick period for \p rhs
+/// \param lhs left-hand frequency to reduce
+/// \param rhs right-hand frequency to reduce by
+/// \return remainder of the tick counts of \p lhs and \p rhs
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+FREQUENCYPP_INLINE constexpr auto operator%(
+    const frequency<Rep1, Period1>& lhs, const frequency<Rep2, Period2>& rhs)
+    -> std::common_type_t<Rep1, Rep2>
+{
+    using ct = std::common_type_t<std::decay_t<decltype(lhs)>, std::decay_t<decltype(rhs)>>;
+    return ct{lhs}.count() % ct{rhs}.count();
+}
+
+// Numeric
+
+/// Compute the floor of frequency \p f
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return greatest duration representable in \p ToFrequency that is less than or equal to \p f
+template<typename ToFrequency, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto floor(const frequency<Rep, Period>& f) -> ToFrequency
+{
+    const auto t = frequency_cast<ToFrequency>(f);
+    // Scalar representations branch, so that the adjustment is not computed at the limits where
+    // it is unused and would overflow
+    if constexpr (std::is_same_v<decltype(t > f), bool>) {
+        if (t > f) {
+            return t - ToFrequency{1};
+        }
+        return t;
+    }
+    else {
+        return detail::select(t > f, ToFrequency{t - ToFrequency{1}}, t);
+    }
+}
+
+/// Compute the ceiling of frequency \p f
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return smallest duration representable in \p ToFrequency that is greater than or equal to \p f
+template<typename ToFrequency, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto ceil(const frequency<Rep, Period>& f) -> ToFrequency
+{
+    const auto t = frequency_cast<ToFrequency>(f);
+    if constexpr (std::is_same_v<decltype(t < f), bool>) {
+        if (t < f) {
+            return t + ToFrequency{1};
+        }
+        return t;
+    }
+    else {
+        return detail::select(t < f, ToFrequency{t + ToFrequency{1}}, t);
+    }
+}
+
+/// Round frequency \p f to its closest representation in \p ToFrequency
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return value representable in \p ToFrequency that is closest to \p f, rounded to even in
+/// halfway cases
+template<typename ToFrequency, typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto round(const frequency<Rep, Period>& f) -> std::enable_if_t<
+    detail::is_frequency_v<
+        ToFrequency> && !std::chrono::treat_as_floating_point_v<typename ToFrequency::rep>,
+    ToFrequency>
+{
+    const auto t0 = floor<ToFrequency>(f);
+    const auto t1 = ToFrequency{t0 + ToFrequency{1}};
+    const auto diff0 = f - t0;
+    const auto diff1 = t1 - f;
+    const auto even = detail::select((t0.count() % 2) == 0, t0, t1);
+    return detail::select(diff0 == diff1, even, detail::select(diff0 < diff1, t0, t1));
+}
+
+/// Compute the absolute value of frequency \p f
+///
+/// \tparam Rep arithmetic type representing the number of ticks for \p f
+/// \tparam Period ratio representing the tick period for \p f
+/// \param f frequency to convert
+/// \return absolute value of \p f
+template<typename Rep, typename Period>
+FREQUENCYPP_INLINE constexpr auto abs(frequency<Rep, Period> f)
+    -> std::enable_if_t<std::numeric_limits<Rep>::is_signed, frequency<Rep, Period>>
+{
+    return detail::select(f >= f.zero(), f, frequency<Rep, Period>{-f});
+}
+
+inline namespace literals {
+
+/// Literal suffix for frequencies of type \ref frequencypp::nanohertz
+///
+/// \param r tick count
+/// \return nanohertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _nHz(unsigned long long r) -> nanohertz
+{
+    return nanohertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer nanohertz
+///
+/// \param r tick count
+/// \return nanohertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _nHz(long double r)
+    -> frequency<long double, std::nano>
+{
+    return frequency<long double, std::nano>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::microhertz
+///
+/// \param r tick count
+/// \return microhertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _uHz(unsigned long long r) -> microhertz
+{
+    return microhertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer microhertz
+///
+/// \param r tick count
+/// \return microhertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _uHz(long double r)
+    -> frequency<long double, std::micro>
+{
+    return frequency<long double, std::micro>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::millihertz
+///
+/// \param r tick count
+/// \return millihertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _mHz(unsigned long long r) -> millihertz
+{
+    return millihertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer millihertz
+///
+/// \param r tick count
+/// \return millihertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _mHz(long double r)
+    -> frequency<long double, std::milli>
+{
+    return frequency<long double, std::milli>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::hertz
+///
+/// \param r tick count
+/// \return millihertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _Hz(unsigned long long r) -> hertz
+{
+    return hertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer hertz
+///
+/// \param r tick count
+/// \return millihertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _Hz(long double r) -> frequency<long double>
+{
+    return frequency<long double>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::kilohertz
+///
+/// \param r tick count
+/// \return kilohertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _KHz(unsigned long long r) -> kilohertz
+{
+    return kilohertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer kilohertz
+///
+/// \param r tick count
+/// \return kilohertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _KHz(long double r)
+    -> frequency<long double, std::kilo>
+{
+    return frequency<long double, std::kilo>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::megahertz
+///
+/// \param r tick count
+/// \return megahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _MHz(unsigned long long r) -> megahertz
+{
+    return megahertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer megahertz
+///
+/// \param r tick count
+/// \return megahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _MHz(long double r)
+    -> frequency<long double, std::mega>
+{
+    return frequency<long double, std::mega>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::gigahertz
+///
+/// \param r tick count
+/// \return gigahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _GHz(unsigned long long r) -> gigahertz
+{
+    return gigahertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer gigahertz
+///
+/// \param r tick count
+/// \return gigahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _GHz(long double r)
+    -> frequency<long double, std::giga>
+{
+    return frequency<long double, std::giga>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::terahertz
+///
+/// \param r tick count
+/// \return terahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _THz(unsigned long long r) -> terahertz
+{
+    return terahertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer terahertz
+///
+/// \param r tick count
+/// \return terahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _THz(long double r)
+    -> frequency<long double, std::tera>
+{
+    return frequency<long double, std::tera>{r};
+}
+
+/// Literal suffix for frequencies of type \ref frequencypp::petahertz
+///
+/// \param r tick count
+/// \return petahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _PHz(unsigned long long r) -> petahertz
+{
+    return petahertz{r};
+}
+
+/// Literal suffix for frequencies representing non-integer petahertz
+///
+/// \param r tick count
+/// \return petahertz with tick count \p r
+FREQUENCYPP_INLINE constexpr auto operator"" _PHz(long double r)
+    -> frequency<long double, std::peta>
+{
+    return frequency<long double, std::peta>{r};
+}
+
+} // namespace literals
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_FREQUENCY_CORE_HPP
@@ -0,0 +1,50 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains forward declarations of \ref frequencypp::frequency and its associated types, and the
+/// SI unit aliases, for headers that name frequency types without using them
+
+#ifndef FREQUENCYPP_FREQUENCY_FWD_HPP
+#define FREQUENCYPP_FREQUENCY_FWD_HPP
+
+#include <cstdint>
+#include <ratio>
+
+namespace frequencypp {
+
+template<typename Rep, typename Period = std::ratio<1>>
+struct frequency;
+
+template<typename Rep>
+struct frequency_values;
+
+template<typename Mask>
+struct frequency_select;
+
+// SI units
+
+using nanohertz = frequency<std::int64_t, std::nano>; ///< Frequency specified in nanohertz (nHz)
+using microhertz = frequency<std::int64_t, std::micro>; ///< Frequency specified in microhertz (uHz)
+using millihertz = frequency<std::int64_t, std::milli>; ///< Frequency specified in millihertz (mHz)
+using hertz = frequency<std::int64_t>; ///< Frequency specified in hertz (Hz)
+using kilohertz = frequency<std::int64_t, std::kilo>; ///< Frequency specified in kilohertz (KHz)
+using megahertz = frequency<std::int64_t, std::mega>; ///< Frequency specified in megahertz (MHz)
+using gigahertz = frequency<std::int32_t, std::giga>; ///< Frequency specified in gigahertz (GHz)
+using terahertz = frequency<std::int32_t, std::tera>; ///< Frequency specified in terahertz (THz)
+using petahertz = frequency<std::int16_t, std::peta>; ///< Frequency specified in petahertz (PHz)
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_FREQUENCY_FWD_HPP
@@ -0,0 +1,159 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the stream insertion operator for \ref frequencypp::frequency
+
+#ifndef FREQUENCYPP_FREQUENCY_IO_HPP
+#define FREQUENCYPP_FREQUENCY_IO_HPP
+
+#include <ios>
+#include <ostream>
+#include <ratio>
+#include <sstream>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+#if FREQUENCYPP_HAS_INT128
+
+/// Insert 128-bit integer \p v into \p os, which has no inserter for it, following the base,
+/// showbase, showpos, and uppercase flags of \p os as the inserters of the other integers do
+template<typename CharT, typename Traits, typename Int>
+auto insert_int128(std::basic_ostream<CharT, Traits>& os, Int v) -> void
+{
+    const auto flags = os.flags();
+    const auto basefield = flags & std::ios_base::basefield;
+    const auto base =
+        basefield == std::ios_base::hex ? 16U : (basefield == std::ios_base::oct ? 8U : 10U);
+    const auto upper = (flags & std::ios_base::uppercase) != 0;
+    const auto show_base = (flags & std::ios_base::showbase) != 0;
+
+    // Only decimal output is signed; octal and hexadecimal show the two's complement bits
+    auto negative = false;
+    if constexpr (std::is_same_v<Int, int128_t>) {
+        negative = base == 10 && v < 0;
+    }
+    auto u = negative ? uint128_t{0} - static_cast<uint128_t>(v) : static_cast<uint128_t>(v);
+
+    const auto* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char buffer[132] = {};
+    auto* const last = buffer + sizeof(buffer);
+    auto* first = last;
+    do {
+        *--first = digits[u % base];
+        u /= base;
+    } while (u != 0);
+    if (show_base && base == 16) {
+        *--first = upper ? 'X' : 'x';
+        *--first = '0';
+    }
+    else if (show_base && base == 8 && *first != '0') {
+        *--first = '0';
+    }
+    else if (negative) {
+        *--first = '-';
+    }
+    else if (base == 10 && (flags & std::ios_base::showpos) != 0) {
+        *--first = '+';
+    }
+    for (; first != last; ++first) {
+        os.put(os.widen(*first));
+    }
+}
+
+#endif
+
+/// Insert tick count \p r into \p os
+template<typename CharT, typename Traits, typename Rep>
+auto insert_count(std::basic_ostream<CharT, Traits>& os, const Rep& r) -> void
+{
+    // The 128-bit inserter is declared only where the types exist, which is the only case in which
+    // this branch is instantiated
+    if constexpr (is_int128_v<Rep>) {
+        insert_int128(os, r);
+    }
+    else {
+        os << r;
+    }
+}
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Inserts a textual representation of \p f into \p os
+///
+/// The frequency is inserted into \p os as a string after being formatted out-of-line in a stream
+/// that matches the flags, locale, and precision of \p os.
+///
+/// \tparam CharT character type of the stream
+/// \tparam Traits character traits for the stream
+/// \tparam Rep arithmetic type representing the number of ticks
+/// \tparam Period ratio representing the tick period
+/// \param os stream to insert into
+/// \param f frequency to insert
+/// \return reference to \p os
+template<typename CharT, typename Traits, typename Rep, typename Period>
+auto operator<<(std::basic_ostream<CharT, Traits>& os, const frequency<Rep, Period>& f)
+    -> std::basic_ostream<CharT, Traits>&
+{
+    std::basic_ostringstream<CharT, Traits> s;
+    s.flags(os.flags());
+    s.imbue(os.getloc());
+    s.precision(os.precision());
+    detail::insert_count(s, f.count());
+
+    // Select the unit suffix at compile-time
+    if constexpr (std::ratio_equal_v<Period, std::nano>) {
+        s << "nHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::micro>) {
+        s << "µHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::milli>) {
+        s << "mHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::ratio<1>>) {
+        s << "Hz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::kilo>) {
+        s << "KHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::mega>) {
+        s << "MHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::giga>) {
+        s << "GHz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::tera>) {
+        s << "THz";
+    }
+    else if constexpr (std::ratio_equal_v<Period, std::peta>) {
+        s << "PHz";
+    }
+    else if constexpr (Period::type::den == 1) {
+        s << '[' << Period::type::num << "]Hz";
+    }
+    else {
+        s << '[' << Period::type::num << '/' << Period::type::den << "]Hz";
+    }
+
+    return os << s.str();
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_FREQUENCY_IO_HPP
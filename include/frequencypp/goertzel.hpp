@@ -0,0 +1,267 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the Goertzel filter bank \ref frequencypp::goertzel_bank, which measures the power of
+/// a signal at a set of target frequencies
+
+#ifndef FREQUENCYPP_GOERTZEL_HPP
+#define FREQUENCYPP_GOERTZEL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <frequencypp/fft.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+/// Compute the Goertzel coefficient 2 cos(2 pi f / rate) of target \p f at sample rate \p rate
+///
+/// The ratio is taken between the tick counts of the common type of \p f and \p rate, so that
+/// the units cancel exactly, and whole cycles per sample are removed from it before it is
+/// converted to floating point.
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+auto goertzel_coefficient(const frequency<Rep1, Period1>& f, const frequency<Rep2, Period2>& rate)
+    -> long double
+{
+    using ct = std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>;
+    constexpr auto tau = 6.283185307179586476925286766559L;
+    auto num = ct{f}.count();
+    const auto den = ct{rate}.count();
+    if constexpr (std::chrono::treat_as_floating_point_v<typename ct::rep>) {
+        num = std::fmod(num, den);
+    }
+    else {
+        num %= den;
+    }
+    return 2 * std::cos(tau * static_cast<long double>(num) / static_cast<long double>(den));
+}
+
+template<typename V>
+auto goertzel_step(const V& x, const V& c, V& s1, V& s2) -> void
+{
+    const V s0 = x + c * s1 - s2;
+    s2 = s1;
+    s1 = s0;
+}
+
+/// Run the \p n samples of \p x through one vector of filters for each of \p I, whose
+/// coefficients and two most recent outputs are at \p coefficient, \p s1, and \p s2
+///
+/// The filters are expanded over \p I rather than looped over, so that their states stay in
+/// registers for the whole pass over \p x and their independent recurrences overlap.
+template<typename V, typename T, std::size_t... I>
+auto goertzel_tile(const T* x, std::size_t n, const T* coefficient, T* s1, T* s2,
+    std::index_sequence<I...> /*unused*/) -> void
+{
+    constexpr auto lanes = fft_lanes<V>;
+    const V c[] = {fft_load<V>(coefficient + I * lanes)...};
+    V a[] = {fft_load<V>(s1 + I * lanes)...};
+    V b[] = {fft_load<V>(s2 + I * lanes)...};
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto xi = V(x[i]);
+        (goertzel_step(xi, c[I], a[I], b[I]), ...);
+    }
+    (fft_store(s1 + I * lanes, a[I]), ...);
+    (fft_store(s2 + I * lanes, b[I]), ...);
+}
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Bank of Goertzel filters measuring the power of a signal at each of a set of target
+/// frequencies over consecutive blocks of samples
+///
+/// Each filter evaluates one term of the discrete Fourier transform of a block, at its target
+/// frequency rather than at the nearest bin, so a bank of a few dozen targets costs far less than
+/// a full transform.  The filters are interleaved in the lanes of \ref frequencypp::simd vectors,
+/// and tiles of several vectors stay in registers while they run over the samples, so that every
+/// sample is loaded once per tile and updates every filter of the tile.
+///
+/// Powers are reported at the end of each block, after which the filters restart.  A sinusoid of
+/// amplitude \c A at a target frequency yields a power of about (A * block size / 2)^2 there.
+///
+/// \tparam T floating-point type of the samples and powers
+template<typename T = double>
+class goertzel_bank
+{
+    static_assert(std::is_floating_point_v<T>, "T must be a floating-point type");
+
+    using vector = typename detail::fft_vector<T>::type;
+    static constexpr auto lanes = detail::fft_lanes<vector>;
+    static constexpr auto tile = std::size_t{4};
+
+    std::size_t size_;
+    std::size_t block_size_;
+    std::size_t filled_ = 0;
+    // Coefficients and filter states are padded to whole vectors
+    std::vector<T> coefficients_;
+    std::vector<T> s1_;
+    std::vector<T> s2_;
+    std::vector<T> powers_;
+
+    auto finish_block() -> void
+    {
+        for (std::size_t i = 0; i < size_; ++i) {
+            powers_[i] = s1_[i] * s1_[i] + s2_[i] * s2_[i] - coefficients_[i] * s1_[i] * s2_[i];
+        }
+        reset();
+    }
+
+public:
+    /// Construct a bank measuring the \p n frequencies of \p targets in signals sampled at \p
+    /// sample_rate, over blocks of \p block_size samples
+    ///
+    /// \tparam Rep1 arithmetic type representing the number of ticks for \p targets
+    /// \tparam Period1 ratio representing the tick period for \p targets
+    /// \tparam Rep2 arithmetic type representing the number of ticks for \p sample_rate
+    /// \tparam Period2 ratio representing the tick period for \p sample_rate
+    /// \param targets frequencies to measure, each below half of \p sample_rate
+    /// \param n number of frequencies in \p targets
+    /// \param sample_rate rate at which the samples are taken, which must be positive
+    /// \param block_size number of samples per block, which must be positive
+    template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+    goertzel_bank(const frequency<Rep1, Period1>* targets, std::size_t n,
+        const frequency<Rep2, Period2>& sample_rate, std::size_t block_size)
+        : size_(n)
+        , block_size_(block_size)
+        , coefficients_((n + lanes - 1) / lanes * lanes)
+        , s1_(coefficients_.size())
+        , s2_(coefficients_.size())
+        , powers_(n)
+    {
+        // An empty block never finishes, and a zero rate leaves no coefficient to compute
+        assert(block_size > 0 && "the block size must be positive");
+        assert((sample_rate > frequency<Rep2, Period2>::zero())
+            && "the sample rate must be positive");
+        for (std::size_t i = 0; i < n; ++i) {
+            coefficients_[i] =
+                static_cast<T>(detail::goertzel_coefficient(targets[i], sample_rate));
+        }
+    }
+
+    /// Get the number of target frequencies
+    ///
+    /// \return number of target frequencies
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    /// Get the number of samples per block
+    ///
+    /// \return number of samples per block
+    [[nodiscard]] auto block_size() const noexcept -> std::size_t
+    {
+        return block_size_;
+    }
+
+    /// Get the coefficient 2 cos(2 pi f / sample rate) of the filter for target \p i
+    ///
+    /// \param i index of the target
+    /// \return coefficient of the filter for target \p i
+    [[nodiscard]] auto coefficient(std::size_t i) const -> T
+    {
+        return coefficients_[i];
+    }
+
+    /// Get the power at target \p i over the most recently completed block
+    ///
+    /// \param i index of the target
+    /// \return power at target \p i, or zero if no block has completed
+    [[nodiscard]] auto power(std::size_t i) const -> T
+    {
+        return powers_[i];
+    }
+
+    /// Get the powers at every target over the most recently completed block
+    ///
+    /// \return pointer to \ref frequencypp::goertzel_bank::size powers, in the order of the targets
+    [[nodiscard]] auto powers() const noexcept -> const T*
+    {
+        return powers_.data();
+    }
+
+    /// Discard the samples of the current block
+    auto reset() -> void
+    {
+        std::fill(s1_.begin(), s1_.end(), T{0});
+        std::fill(s2_.begin(), s2_.end(), T{0});
+        filled_ = 0;
+    }
+
+    /// Run the \p n samples of \p samples through the filters, calling \p on_block with the
+    /// powers at every target whenever a block completes
+    ///
+    /// Samples that do not complete a block are kept in the filters, so a stream may be processed
+    /// in pieces of any length.
+    ///
+    /// \tparam Callback type of a callable taking a pointer to the powers
+    /// \param samples samples to process
+    /// \param n number of samples in \p samples
+    /// \param on_block callable receiving \ref frequencypp::goertzel_bank::powers at the end of
+    /// each block
+    /// \return number of blocks completed
+    template<typename Callback>
+    auto process(const T* samples, std::size_t n, Callback&& on_block) -> std::size_t
+    {
+        const auto vectors = coefficients_.size() / lanes;
+        auto blocks = std::size_t{0};
+        while (n > 0) {
+            const auto m = std::min(n, block_size_ - filled_);
+            auto v = std::size_t{0};
+            for (; v + tile <= vectors; v += tile) {
+                detail::goertzel_tile<vector>(samples, m, coefficients_.data() + v * lanes,
+                    s1_.data() + v * lanes, s2_.data() + v * lanes,
+                    std::make_index_sequence<tile>{});
+            }
+            for (; v < vectors; ++v) {
+                detail::goertzel_tile<vector>(samples, m, coefficients_.data() + v * lanes,
+                    s1_.data() + v * lanes, s2_.data() + v * lanes, std::index_sequence<0>{});
+            }
+            samples += m;
+            n -= m;
+            filled_ += m;
+            if (filled_ == block_size_) {
+                finish_block();
+                ++blocks;
+                on_block(powers());
+            }
+        }
+        return blocks;
+    }
+
+    /// Run the \p n samples of \p samples through the filters, keeping the powers of the last
+    /// block completed
+    ///
+    /// \param samples samples to process
+    /// \param n number of samples in \p samples
+    /// \return number of blocks completed
+    auto process(const T* samples, std::size_t n) -> std::size_t
+    {
+        return process(samples, n, [](const T*) {});
+    }
+};
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_GOERTZEL_HPP
@@ -0,0 +1,71 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the specialization of \c std::hash for \ref frequencypp::frequency
+
+#ifndef FREQUENCYPP_HASH_HPP
+#define FREQUENCYPP_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+/// Hash of a tick count, which is that of the standard library where it has one
+template<typename Rep, typename = void>
+struct count_hash : std::hash<Rep>
+{};
+
+#if FREQUENCYPP_HAS_INT128
+
+/// Hash of a 128-bit tick count, which the standard library does not provide, combining the hashes
+/// of its halves
+template<typename Rep>
+struct count_hash<Rep, std::enable_if_t<is_int128_v<Rep>>>
+{
+    auto operator()(Rep r) const noexcept -> std::size_t
+    {
+        // Combined as boost::hash_combine does, with the fractional bits of the golden ratio
+        constexpr auto golden = static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+        const auto u = static_cast<uint128_t>(r);
+        const auto low = std::hash<std::uint64_t>{}(static_cast<std::uint64_t>(u));
+        const auto high = std::hash<std::uint64_t>{}(static_cast<std::uint64_t>(u >> 64));
+        return low ^ (high + golden + (low << 6) + (low >> 2));
+    }
+};
+
+#endif
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::hash for \ref frequencypp::frequency, which hashes the tick count
+template<typename Rep, typename Period>
+struct std::hash<frequencypp::frequency<Rep, Period>>
+{
+    /// Hash frequency \p f
+    ///
+    /// \param f frequency to hash
+    /// \return hash of \p f
+    auto operator()(const frequencypp::frequency<Rep, Period>& f) const noexcept -> std::size_t
+    {
+        return frequencypp::detail::count_hash<Rep>{}(f.count());
+    }
+};
+
+#endif // FREQUENCYPP_HASH_HPP
@@ -0,0 +1,270 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains functions relating the rates of a set of periodic tasks: their greatest common
+/// divisor and least common multiple, the hyperperiod after which their schedule repeats, and
+/// the divisors of a base tick that runs every task
+
+#ifndef FREQUENCYPP_HYPERPERIOD_HPP
+#define FREQUENCYPP_HYPERPERIOD_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+#include <frequencypp/detail/int128.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+// Tick counts are converted to the common period and combined in the widest integers available,
+// so that sets mixing coarse and fine units do not overflow before the result is known
+#if FREQUENCYPP_HAS_INT128
+using wide_int = int128_t;
+using wide_uint = uint128_t;
+#else
+using wide_int = std::intmax_t;
+using wide_uint = std::uintmax_t;
+#endif
+
+constexpr auto wide_gcd(wide_uint a, wide_uint b) noexcept -> wide_uint
+{
+    while (b != 0) {
+        const auto r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+constexpr auto wide_lcm(wide_uint a, wide_uint b) noexcept -> wide_uint
+{
+    return a == 0 || b == 0 ? 0 : a / wide_gcd(a, b) * b;
+}
+
+/// Get the magnitude of the tick count of \p f in ticks of \p ToFrequency, whose period divides
+/// that of \p f
+template<typename ToFrequency, typename Rep, typename Period>
+constexpr auto wide_count(const frequency<Rep, Period>& f) noexcept -> wide_uint
+{
+    static_assert(std::is_integral_v<Rep>, "Frequencies must have integral tick counts");
+    using scale = typename std::ratio_divide<Period, typename ToFrequency::period>::type;
+    static_assert(scale::den == 1, "ToFrequency must have a period dividing that of the frequency");
+    const auto count = static_cast<wide_int>(f.count());
+    return static_cast<wide_uint>(count < 0 ? -count : count) * static_cast<wide_uint>(scale::num);
+}
+
+template<typename... Frequencies>
+constexpr bool are_frequencies_v =
+    sizeof...(Frequencies) > 0 && (is_frequency_v<Frequencies> && ...);
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Compute the greatest common divisor of frequencies \p fs, which is the highest rate of which
+/// each of \p fs is an integral multiple
+///
+/// \tparam Frequencies \ref frequencypp::frequency types with integral tick counts
+/// \param fs frequencies to divide
+/// \return greatest common divisor of the magnitudes of \p fs
+template<typename... Frequencies,
+    typename = std::enable_if_t<detail::are_frequencies_v<Frequencies...>>>
+constexpr auto gcd(const Frequencies&... fs) -> std::common_type_t<Frequencies...>
+{
+    using ct = std::common_type_t<Frequencies...>;
+    auto g = detail::wide_uint{0};
+    ((g = detail::wide_gcd(g, detail::wide_count<ct>(fs))), ...);
+    return ct{static_cast<typename ct::rep>(g)};
+}
+
+/// Compute the greatest common divisor of frequencies \p f1 and \p f2
+///
+/// This overload is more specialized than \c std::gcd, which is found by argument-dependent
+/// lookup through the period of a frequency, so that an unqualified call on two frequencies
+/// resolves here.
+///
+/// \tparam Rep1 integral type representing the number of ticks for \p f1
+/// \tparam Period1 ratio representing the tick period for \p f1
+/// \tparam Rep2 integral type representing the number of ticks for \p f2
+/// \tparam Period2 ratio representing the tick period for \p f2
+/// \param f1 first frequency to divide
+/// \param f2 second frequency to divide
+/// \return greatest common divisor of the magnitudes of \p f1 and \p f2
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+constexpr auto gcd(const frequency<Rep1, Period1>& f1, const frequency<Rep2, Period2>& f2)
+    -> std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>;
+    const auto g = detail::wide_gcd(detail::wide_count<ct>(f1), detail::wide_count<ct>(f2));
+    return ct{static_cast<typename ct::rep>(g)};
+}
+
+/// Compute the greatest common divisor of the \p n frequencies of \p fs
+///
+/// \tparam Rep integral type representing the number of ticks for \p fs
+/// \tparam Period ratio representing the tick period for \p fs
+/// \param fs frequencies to divide
+/// \param n number of frequencies in \p fs
+/// \return greatest common divisor of the magnitudes of \p fs, or zero if \p n is zero
+template<typename Rep, typename Period>
+constexpr auto gcd(const frequency<Rep, Period>* fs, std::size_t n) -> frequency<Rep, Period>
+{
+    auto g = detail::wide_uint{0};
+    for (std::size_t i = 0; i < n; ++i) {
+        g = detail::wide_gcd(g, detail::wide_count<frequency<Rep, Period>>(fs[i]));
+    }
+    return frequency<Rep, Period>{static_cast<Rep>(g)};
+}
+
+/// Compute the least common multiple of frequencies \p fs, which is the lowest rate that is an
+/// integral multiple of each of \p fs
+///
+/// The multiple is computed in 128-bit arithmetic where available, so it is exact whenever it is
+/// representable in the common type of \p fs.
+///
+/// \tparam Frequencies \ref frequencypp::frequency types with integral tick counts
+/// \param fs frequencies to multiply
+/// \return least common multiple of the magnitudes of \p fs, or zero if any of \p fs is zero
+template<typename... Frequencies,
+    typename = std::enable_if_t<detail::are_frequencies_v<Frequencies...>>>
+constexpr auto lcm(const Frequencies&... fs) -> std::common_type_t<Frequencies...>
+{
+    using ct = std::common_type_t<Frequencies...>;
+    auto l = detail::wide_uint{1};
+    ((l = detail::wide_lcm(l, detail::wide_count<ct>(fs))), ...);
+    return ct{static_cast<typename ct::rep>(l)};
+}
+
+/// Compute the least common multiple of frequencies \p f1 and \p f2
+///
+/// As with \ref frequencypp::gcd, this overload is preferred to \c std::lcm for an unqualified
+/// call on two frequencies.
+///
+/// \tparam Rep1 integral type representing the number of ticks for \p f1
+/// \tparam Period1 ratio representing the tick period for \p f1
+/// \tparam Rep2 integral type representing the number of ticks for \p f2
+/// \tparam Period2 ratio representing the tick period for \p f2
+/// \param f1 first frequency to multiply
+/// \param f2 second frequency to multiply
+/// \return least common multiple of the magnitudes of \p f1 and \p f2, or zero if either is zero
+template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+constexpr auto lcm(const frequency<Rep1, Period1>& f1, const frequency<Rep2, Period2>& f2)
+    -> std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>
+{
+    using ct = std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>>;
+    const auto l = detail::wide_lcm(detail::wide_count<ct>(f1), detail::wide_count<ct>(f2));
+    return ct{static_cast<typename ct::rep>(l)};
+}
+
+/// Compute the least common multiple of the \p n frequencies of \p fs
+///
+/// \tparam Rep integral type representing the number of ticks for \p fs
+/// \tparam Period ratio representing the tick period for \p fs
+/// \param fs frequencies to multiply
+/// \param n number of frequencies in \p fs
+/// \return least common multiple of the magnitudes of \p fs, or zero if \p n is zero or any of \p
+/// fs is zero
+template<typename Rep, typename Period>
+constexpr auto lcm(const frequency<Rep, Period>* fs, std::size_t n) -> frequency<Rep, Period>
+{
+    auto l = detail::wide_uint{n != 0};
+    for (std::size_t i = 0; i < n; ++i) {
+        l = detail::wide_lcm(l, detail::wide_count<frequency<Rep, Period>>(fs[i]));
+    }
+    return frequency<Rep, Period>{static_cast<Rep>(l)};
+}
+
+/// Compute the hyperperiod of tasks running at rates \p fs, which is the least common multiple
+/// of their periods and so the period of their greatest common divisor
+///
+/// The period is converted as by \ref frequencypp::duration_cast, in 128-bit arithmetic where
+/// available.
+///
+/// \tparam ToDuration \c std::chrono::duration type to convert to
+/// \tparam Frequencies \ref frequencypp::frequency types with integral tick counts
+/// \param fs rates of the tasks, which must be nonzero
+/// \return interval after which the schedule of the tasks repeats
+template<typename ToDuration, typename... Frequencies,
+    typename = std::enable_if_t<detail::are_frequencies_v<Frequencies...>>>
+constexpr auto hyperperiod(const Frequencies&... fs) -> ToDuration
+{
+    using ct = std::common_type_t<Frequencies...>;
+    const auto g = frequencypp::gcd(fs...);
+    return duration_cast<ToDuration>(
+        frequency<detail::wide_int, typename ct::period>{static_cast<detail::wide_int>(g.count())});
+}
+
+/// Compute the hyperperiod of tasks running at the \p n rates of \p fs
+///
+/// \tparam ToDuration \c std::chrono::duration type to convert to
+/// \tparam Rep integral type representing the number of ticks for \p fs
+/// \tparam Period ratio representing the tick period for \p fs
+/// \param fs rates of the tasks, which must be nonzero
+/// \param n number of rates in \p fs, which must be positive
+/// \return interval after which the schedule of the tasks repeats
+template<typename ToDuration, typename Rep, typename Period>
+constexpr auto hyperperiod(const frequency<Rep, Period>* fs, std::size_t n) -> ToDuration
+{
+    const auto g = frequencypp::gcd(fs, n);
+    return duration_cast<ToDuration>(
+        frequency<detail::wide_int, Period>{static_cast<detail::wide_int>(g.count())});
+}
+
+/// Compute the number of ticks of the base tick, which is the least common multiple of \p fs,
+/// between consecutive runs of each task running at the rates \p fs
+///
+/// \tparam Frequencies \ref frequencypp::frequency types with integral tick counts
+/// \param fs rates of the tasks, which must be nonzero
+/// \return divisor of the base tick for each of \p fs, in order
+template<typename... Frequencies,
+    typename = std::enable_if_t<detail::are_frequencies_v<Frequencies...>>>
+constexpr auto tick_divisors(const Frequencies&... fs)
+    -> std::array<typename std::common_type_t<Frequencies...>::rep, sizeof...(Frequencies)>
+{
+    using ct = std::common_type_t<Frequencies...>;
+    using rep = typename ct::rep;
+    auto l = detail::wide_uint{1};
+    ((l = detail::wide_lcm(l, detail::wide_count<ct>(fs))), ...);
+    return {static_cast<rep>(l / detail::wide_count<ct>(fs))...};
+}
+
+/// Compute the divisors of the base tick for tasks running at the \p n rates of \p fs
+///
+/// \tparam Rep integral type representing the number of ticks for \p fs
+/// \tparam Period ratio representing the tick period for \p fs
+/// \param fs rates of the tasks, which must be nonzero
+/// \param n number of rates in \p fs
+/// \param out divisors to store the number of base ticks between runs of each task in
+/// \return rate of the base tick, which is the least common multiple of \p fs
+template<typename Rep, typename Period>
+constexpr auto tick_divisors(const frequency<Rep, Period>* fs, std::size_t n, Rep* out)
+    -> frequency<Rep, Period>
+{
+    auto l = detail::wide_uint{n != 0};
+    for (std::size_t i = 0; i < n; ++i) {
+        l = detail::wide_lcm(l, detail::wide_count<frequency<Rep, Period>>(fs[i]));
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<Rep>(l / detail::wide_count<frequency<Rep, Period>>(fs[i]));
+    }
+    return frequency<Rep, Period>{static_cast<Rep>(l)};
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_HYPERPERIOD_HPP
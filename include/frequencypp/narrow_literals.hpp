@@ -0,0 +1,244 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the opt-in literal suffixes \ref frequencypp::narrow_literals, which choose the
+/// narrowest tick count type for each value
+
+#ifndef FREQUENCYPP_NARROW_LITERALS_HPP
+#define FREQUENCYPP_NARROW_LITERALS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+/// Widest signed and unsigned integer types that literals are parsed into
+#if FREQUENCYPP_HAS_INT128
+using widest_int = int128_t;
+using widest_uint = uint128_t;
+#else
+using widest_int = std::int64_t;
+using widest_uint = std::uint64_t;
+#endif
+
+/// Value of an integer literal, and whether it is an integer literal that fits in \ref widest_int
+struct parsed_integer_literal
+{
+    widest_uint value;
+    bool integer;
+    bool fits;
+};
+
+constexpr auto literal_digit(char c) noexcept -> int
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/// Parse the characters of a decimal, hexadecimal, octal, or binary integer literal, which may
+/// contain digit separators
+template<char... Cs>
+constexpr auto parse_integer_literal() noexcept -> parsed_integer_literal
+{
+    constexpr char chars[] = {Cs...};
+    constexpr auto max = static_cast<widest_uint>(std::numeric_limits<widest_int>::max());
+    auto result = parsed_integer_literal{0, true, true};
+    auto base = 10;
+    auto i = std::size_t{0};
+    if (sizeof...(Cs) > 1 && chars[0] == '0') {
+        if (chars[1] == 'x' || chars[1] == 'X') {
+            base = 16;
+            i = 2;
+        }
+        else if (chars[1] == 'b' || chars[1] == 'B') {
+            base = 2;
+            i = 2;
+        }
+        else {
+            base = 8;
+            i = 1;
+        }
+    }
+    for (; i < sizeof...(Cs); ++i) {
+        if (chars[i] == '\'') {
+            continue;
+        }
+        const auto d = literal_digit(chars[i]);
+        if (d < 0 || d >= base) {
+            result.integer = false;
+            return result;
+        }
+        const auto digit = static_cast<widest_uint>(d);
+        if (result.value > (max - digit) / static_cast<widest_uint>(base)) {
+            result.fits = false;
+            return result;
+        }
+        result.value = result.value * static_cast<widest_uint>(base) + digit;
+    }
+    return result;
+}
+
+template<typename T>
+constexpr auto fits_in(widest_uint v) noexcept -> bool
+{
+    return v <= static_cast<widest_uint>(std::numeric_limits<T>::max());
+}
+
+/// Narrowest signed integral type that holds \p V
+template<widest_uint V>
+using narrowest_signed_t = std::conditional_t<fits_in<std::int8_t>(V),
+    std::int8_t,
+    std::conditional_t<fits_in<std::int16_t>(V),
+        std::int16_t,
+        std::conditional_t<fits_in<std::int32_t>(V),
+            std::int32_t,
+            std::conditional_t<fits_in<std::int64_t>(V), std::int64_t, widest_int>>>>;
+
+template<typename Period, char... Cs>
+FREQUENCYPP_INLINE constexpr auto make_narrow_frequency() noexcept
+{
+    constexpr auto parsed = parse_integer_literal<Cs...>();
+    static_assert(parsed.integer, "narrow frequency literals must be integers");
+    static_assert(parsed.fits, "narrow frequency literals must fit in the widest integer type");
+    using rep = narrowest_signed_t<parsed.value>;
+    return frequency<rep, Period>{static_cast<rep>(parsed.value)};
+}
+
+} // namespace frequencypp::detail
+
+/// Literal suffixes whose tick count is the narrowest of \c std::int8_t, \c std::int16_t, \c
+/// std::int32_t, \c std::int64_t, and \ref frequencypp::int128_t that holds the value
+///
+/// The suffixes are those of \ref frequencypp::literals, so that \c 50_Hz is a frequency with a
+/// \c std::int8_t tick count and \c 50000_Hz one with a \c std::int32_t tick count.  A value that
+/// does not fit in the widest of these that the compiler provides does not compile.  The results
+/// combine with other frequencies through the usual \c std::common_type rules, so adding \c 50_Hz
+/// to a \ref frequencypp::hertz yields a \ref frequencypp::hertz.  The common type of two
+/// frequencies of different periods has a tick count of at least \c std::int64_t, so that mixing
+/// units does not overflow in the conversion to the common period: \c 1_KHz + \c 1_Hz is a
+/// \ref frequencypp::hertz of 1001.  Arithmetic between frequencies of the same narrow type stays
+/// in that type and may overflow it, as with the built-in integers.
+///
+/// The namespace is not inline, so it must be brought into scope by name.  The integer suffixes of
+/// \ref frequencypp::literals take precedence over these if both are in scope, so the two should
+/// not be used together.
+namespace frequencypp::narrow_literals {
+
+/// Literal suffix for nanohertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return nanohertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _nHz()
+{
+    return detail::make_narrow_frequency<std::nano, Cs...>();
+}
+
+/// Literal suffix for microhertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return microhertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _uHz()
+{
+    return detail::make_narrow_frequency<std::micro, Cs...>();
+}
+
+/// Literal suffix for millihertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return millihertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _mHz()
+{
+    return detail::make_narrow_frequency<std::milli, Cs...>();
+}
+
+/// Literal suffix for hertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return hertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _Hz()
+{
+    return detail::make_narrow_frequency<std::ratio<1>, Cs...>();
+}
+
+/// Literal suffix for kilohertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return kilohertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _KHz()
+{
+    return detail::make_narrow_frequency<std::kilo, Cs...>();
+}
+
+/// Literal suffix for megahertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return megahertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _MHz()
+{
+    return detail::make_narrow_frequency<std::mega, Cs...>();
+}
+
+/// Literal suffix for gigahertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return gigahertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _GHz()
+{
+    return detail::make_narrow_frequency<std::giga, Cs...>();
+}
+
+/// Literal suffix for terahertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return terahertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _THz()
+{
+    return detail::make_narrow_frequency<std::tera, Cs...>();
+}
+
+/// Literal suffix for petahertz with the narrowest signed tick count that holds the value
+///
+/// \tparam Cs characters of the integer literal
+/// \return petahertz with the value of the literal
+template<char... Cs>
+FREQUENCYPP_INLINE constexpr auto operator"" _PHz()
+{
+    return detail::make_narrow_frequency<std::peta, Cs...>();
+}
+
+} // namespace frequencypp::narrow_literals
+
+#endif // FREQUENCYPP_NARROW_LITERALS_HPP
@@ -0,0 +1,220 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the compile-time parser of frequency strings such as \c "32.768kHz"
+
+#ifndef FREQUENCYPP_PARSE_HPP
+#define FREQUENCYPP_PARSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+/// Widest signed integer type that parsed tick counts are accumulated in
+#if FREQUENCYPP_HAS_INT128
+using parsed_count = int128_t;
+#else
+using parsed_count = std::int64_t;
+#endif
+
+/// Result of parsing a frequency string, whose value is \c count * 10^exponent hertz
+struct parsed_frequency
+{
+    parsed_count count;
+    int exponent;
+    bool valid;
+};
+
+// Exponents beyond this do not fit a std::ratio of std::intmax_t
+constexpr auto max_parsed_exponent = 18;
+
+constexpr auto parse_si_prefix(const char*& s) noexcept -> int
+{
+    switch (*s) {
+    case 'a': ++s; return -18;
+    case 'f': ++s; return -15;
+    case 'p': ++s; return -12;
+    case 'n': ++s; return -9;
+    case 'u': ++s; return -6;
+    case 'm': ++s; return -3;
+    case 'k':
+    case 'K': ++s; return 3;
+    case 'M': ++s; return 6;
+    case 'G': ++s; return 9;
+    case 'T': ++s; return 12;
+    case 'P': ++s; return 15;
+    case 'E': ++s; return 18;
+    case '\xC2': // The micro sign, U+00B5, in UTF-8
+        if (s[1] == '\xB5') {
+            s += 2;
+            return -6;
+        }
+        return 0;
+    default: return 0;
+    }
+}
+
+/// Parse a decimal number, an optional space, an optional SI prefix, and the unit \c Hz
+///
+/// The count holds every digit written, and the exponent places the decimal point and applies the
+/// prefix, so that the value is represented exactly.
+constexpr auto parse_frequency(const char* s) noexcept -> parsed_frequency
+{
+    constexpr auto max = std::numeric_limits<parsed_count>::max();
+    auto result = parsed_frequency{0, 0, false};
+    auto digits = 0;
+    auto fraction = false;
+    for (;; ++s) {
+        if (*s == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        if (*s < '0' || *s > '9') {
+            break;
+        }
+        const auto d = static_cast<parsed_count>(*s - '0');
+        if (result.count > (max - d) / 10) {
+            return result;
+        }
+        result.count = result.count * 10 + d;
+        result.exponent -= fraction ? 1 : 0;
+        ++digits;
+    }
+    if (digits == 0) {
+        return result;
+    }
+    if (*s == ' ') {
+        ++s;
+    }
+    result.exponent += parse_si_prefix(s);
+    result.valid = s[0] == 'H' && s[1] == 'z' && s[2] == '\0'
+        && result.exponent >= -max_parsed_exponent && result.exponent <= max_parsed_exponent;
+    return result;
+}
+
+constexpr auto pow10(int exponent) noexcept -> std::intmax_t
+{
+    auto p = std::intmax_t{1};
+    for (auto i = 0; i < exponent; ++i) {
+        p *= 10;
+    }
+    return p;
+}
+
+template<int Exponent>
+using pow10_ratio = std::conditional_t<(Exponent >= 0),
+    std::ratio<pow10(Exponent >= 0 ? Exponent : 0)>,
+    std::ratio<1, pow10(Exponent < 0 ? -Exponent : 0)>>;
+
+/// Parse the string returned by the static \c value() function of \p Literal into the frequency it
+/// denotes, whose tick count is a \c std::int64_t unless only a 128-bit integer holds it
+template<typename Literal>
+constexpr auto parse_frequency_literal() noexcept
+{
+    constexpr auto parsed = parse_frequency(Literal::value());
+    static_assert(parsed.valid,
+        "frequency strings must be a decimal number that fits in the widest integer type, "
+        "optionally followed by a space, then an optional SI prefix and Hz");
+    using rep = std::conditional_t<(parsed.count <= std::numeric_limits<std::int64_t>::max()),
+        std::int64_t,
+        parsed_count>;
+    return frequency<rep, pow10_ratio<parsed.exponent>>{static_cast<rep>(parsed.count)};
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+template<std::size_t N>
+struct fixed_string
+{
+    char data[N] = {};
+
+    // Implicit conversion from string literals is what deduces the template argument
+    // NOLINTNEXTLINE
+    constexpr fixed_string(const char (&s)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            data[i] = s[i];
+        }
+    }
+};
+
+template<fixed_string S>
+struct fixed_string_literal
+{
+    static constexpr auto value() noexcept -> const char*
+    {
+        return S.data;
+    }
+};
+
+#endif
+
+} // namespace frequencypp::detail
+
+/// Parse string literal \p str, such as \c "32.768kHz", into a frequency at compile time
+///
+/// The string is a decimal number, an optional space, an optional SI prefix, and the unit \c Hz.
+/// The prefixes from \c a (atto) to \c E (exa) are accepted, along with \c K for kilo and either
+/// \c u or the micro sign for micro.  The result has a \c std::int64_t tick count holding every
+/// digit written and a power-of-ten period placing the decimal point, so the value is exact and no
+/// floating-point arithmetic is involved: \c "32.768kHz" is \c frequency<std::int64_t> with a
+/// count of 32768, and \c "2.4GHz" has a period of 10^8 and a count of 24.  Counts beyond \c
+/// std::int64_t are held in \ref frequencypp::int128_t where the compiler provides it.  Strings
+/// that are not of this form are rejected at compile time.
+///
+/// \param str string literal to parse
+/// \return frequency denoted by \p str
+#define FREQUENCYPP_FREQUENCY(str) \
+    ([] { \
+        struct frequencypp_literal \
+        { \
+            static constexpr auto value() noexcept -> const char* \
+            { \
+                return str; \
+            } \
+        }; \
+        return ::frequencypp::detail::parse_frequency_literal<frequencypp_literal>(); \
+    }())
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+namespace frequencypp {
+
+inline namespace literals {
+
+/// Literal suffix parsing a frequency string at compile time, as \ref FREQUENCYPP_FREQUENCY does,
+/// which requires C++20
+///
+/// \tparam S string to parse
+/// \return frequency denoted by \p S
+template<detail::fixed_string S>
+constexpr auto operator"" _freq() noexcept
+{
+    return detail::parse_frequency_literal<detail::fixed_string_literal<S>>();
+}
+
+} // namespace literals
+
+} // namespace frequencypp
+
+#endif
+
+#endif // FREQUENCYPP_PARSE_HPP
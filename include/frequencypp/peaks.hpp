@@ -0,0 +1,223 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains \ref frequencypp::find_peaks, which locates the strongest peaks of a magnitude
+/// spectrum and interpolates their frequencies between bins
+
+#ifndef FREQUENCYPP_PEAKS_HPP
+#define FREQUENCYPP_PEAKS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include <frequencypp/fft.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+/// Model of the shape of a peak, fitted through the magnitudes of a local maximum and its two
+/// neighbours to place the peak between bins
+enum class peak_interpolation
+{
+    /// Fit a parabola to the magnitudes
+    parabolic,
+    /// Fit a parabola to the logarithms of the magnitudes, which is exact for the Gaussian peaks
+    /// of Gaussian-windowed signals and close for most other windows
+    gaussian,
+};
+
+/// Peak of a magnitude spectrum
+///
+/// \tparam Frequency \ref frequencypp::frequency type of the peak frequency
+/// \tparam T arithmetic type of the magnitudes
+template<typename Frequency, typename T>
+struct spectral_peak
+{
+    /// Interpolated frequency of the peak
+    Frequency frequency;
+    /// Interpolated magnitude of the peak
+    T magnitude;
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+/// Get a mask of the lanes of \p V, starting at bin \p i of \p m, that are local maxima above
+/// \p threshold: greater than the bin below and no less than the bin above
+template<typename V, typename T>
+auto peak_lanes(const T* m, std::size_t i, const V& threshold) -> unsigned
+{
+    const auto below = fft_load<V>(m + i - 1);
+    const auto centre = fft_load<V>(m + i);
+    const auto above = fft_load<V>(m + i + 1);
+    if constexpr (std::is_same_v<V, T>) {
+        return centre > below && centre >= above && centre > threshold ? 1U : 0U;
+    }
+    else {
+        const auto hit = (centre > below) && (centre >= above) && (centre > threshold);
+        if (!any_of(hit)) {
+            return 0U;
+        }
+        auto lanes = 0U;
+        for (std::size_t j = 0; j < fft_lanes<V>; ++j) {
+            lanes |= static_cast<unsigned>(hit[j]) << j;
+        }
+        return lanes;
+    }
+}
+
+/// Fit a parabola through \p below, \p centre, and \p above, a strict local maximum, storing the
+/// offset of its vertex from the centre bin in \p offset and returning its height
+inline auto parabolic_vertex(double below, double centre, double above, double& offset) -> double
+{
+    // The denominator is negative because the centre exceeds the mean of its neighbours
+    offset = 0.5 * (below - above) / (below - 2 * centre + above);
+    return centre - 0.25 * (below - above) * offset;
+}
+
+template<typename T>
+auto interpolate_peak(const T* m, std::size_t i, peak_interpolation model, double& offset) -> T
+{
+    const auto below = static_cast<double>(m[i - 1]);
+    const auto centre = static_cast<double>(m[i]);
+    const auto above = static_cast<double>(m[i + 1]);
+    if (model == peak_interpolation::gaussian && below > 0 && above > 0) {
+        return static_cast<T>(std::exp(
+            parabolic_vertex(std::log(below), std::log(centre), std::log(above), offset)));
+    }
+    return static_cast<T>(parabolic_vertex(below, centre, above, offset));
+}
+
+template<typename Frequency, typename T>
+struct peak_order
+{
+    // Orders the weakest peak first, so that the heap of the strongest peaks found so far keeps
+    // the one to evict at its root
+    auto operator()(const spectral_peak<Frequency, T>& lhs,
+        const spectral_peak<Frequency, T>& rhs) const noexcept -> bool
+    {
+        return lhs.magnitude > rhs.magnitude;
+    }
+};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Find the \p k strongest peaks of the \p n magnitudes of \p magnitudes
+///
+/// Bin \c i is a peak if its magnitude exceeds \p threshold and that of bin \c i - 1 and is no
+/// less than that of bin \c i + 1, so the first and last bins are never peaks and a flat top
+/// yields only its lowest bin.  Candidates are detected a vector of bins at a time.  Each peak is
+/// placed between bins by fitting \p model through its magnitude and those of its neighbours,
+/// which gives its frequency as \p start plus its fractional bin index times \p spacing,
+/// converted to \p Frequency with rounding to nearest if its representation is integral.
+///
+/// The strongest peaks are kept in a heap in \p out as they are found, so no memory is allocated
+/// and the cost of a call is linear in \p n.  The peaks are returned strongest first.
+///
+/// \tparam Frequency \ref frequencypp::frequency type of the peak frequencies
+/// \tparam T arithmetic type of the magnitudes
+/// \tparam Rep1 arithmetic type representing the number of ticks for \p start
+/// \tparam Period1 ratio representing the tick period for \p start
+/// \tparam Rep2 arithmetic type representing the number of ticks for \p spacing
+/// \tparam Period2 ratio representing the tick period for \p spacing
+/// \param magnitudes magnitudes of the bins
+/// \param n number of bins in \p magnitudes
+/// \param start frequency of the first bin
+/// \param spacing difference between the frequencies of consecutive bins
+/// \param threshold magnitude that peaks must exceed
+/// \param out peaks to store the results in
+/// \param k number of peaks that \p out can hold
+/// \param model model of the shape of the peaks
+/// \return number of peaks stored in \p out, which is at most \p k
+template<typename Frequency, typename T, typename Rep1, typename Period1, typename Rep2,
+    typename Period2>
+auto find_peaks(const T* magnitudes, std::size_t n, const frequency<Rep1, Period1>& start,
+    const frequency<Rep2, Period2>& spacing, T threshold, spectral_peak<Frequency, T>* out,
+    std::size_t k, peak_interpolation model = peak_interpolation::parabolic) -> std::size_t
+{
+    static_assert(detail::is_frequency_v<Frequency>, "Frequency must be a frequency");
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+
+    using vector = typename detail::fft_vector<T>::type;
+    using exact = frequency<double, typename Frequency::period>;
+    constexpr auto lanes = detail::fft_lanes<vector>;
+
+    if (n < 3 || k == 0) {
+        return 0;
+    }
+
+    const auto origin = frequency_cast<exact>(start).count();
+    const auto step = frequency_cast<exact>(spacing).count();
+    const auto order = detail::peak_order<Frequency, T>{};
+    auto found = std::size_t{0};
+
+    const auto add = [&](std::size_t i) {
+        auto offset = 0.0;
+        const auto magnitude = detail::interpolate_peak(magnitudes, i, model, offset);
+        // A single peak is kept without the heap, which makes the bound of the output visible to
+        // the compiler when k is known
+        if (found == k) {
+            if (!(magnitude > out[0].magnitude)) {
+                return;
+            }
+            if (k > 1) {
+                std::pop_heap(out, out + found, order);
+            }
+            --found;
+        }
+        const auto f = exact{origin + step * (static_cast<double>(i) + offset)};
+        if constexpr (std::chrono::treat_as_floating_point_v<typename Frequency::rep>) {
+            out[found] = {frequency_cast<Frequency>(f), magnitude};
+        }
+        else {
+            out[found] = {round<Frequency>(f), magnitude};
+        }
+        ++found;
+        if (k > 1) {
+            std::push_heap(out, out + found, order);
+        }
+    };
+
+    // Every load of a vector of bins also reads the bins on either side, so the last bin is only
+    // ever read as a neighbour
+    auto i = std::size_t{1};
+    const auto vector_threshold = vector(threshold);
+    for (; i + lanes < n; i += lanes) {
+        const auto hits = detail::peak_lanes(magnitudes, i, vector_threshold);
+        for (std::size_t j = 0; hits >> j != 0; ++j) {
+            if ((hits >> j & 1U) != 0) {
+                add(i + j);
+            }
+        }
+    }
+    for (; i + 1 < n; ++i) {
+        if (detail::peak_lanes(magnitudes, i, threshold) != 0) {
+            add(i);
+        }
+    }
+
+    std::sort_heap(out, out + found, order);
+    return found;
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_PEAKS_HPP
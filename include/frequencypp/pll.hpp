@@ -0,0 +1,453 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the clock synthesis planner \ref frequencypp::plan_pll, which chooses the integer
+/// factors of a phase-locked loop and output divider to produce a target frequency
+
+#ifndef FREQUENCYPP_PLL_HPP
+#define FREQUENCYPP_PLL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <frequencypp/detail/int128.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+#if FREQUENCYPP_HAS_INT128
+
+namespace frequencypp {
+
+/// Inclusive range of an integer factor of a clock synthesizer
+struct pll_range
+{
+    /// Smallest value of the factor
+    std::uint64_t min;
+    /// Largest value of the factor
+    std::uint64_t max;
+};
+
+/// Limits on the synthesizer configurations searched by \ref frequencypp::plan_pll
+struct pll_constraints
+{
+    /// Range of the feedback multiplier N
+    pll_range multiplier = {1, 1};
+    /// Range of the reference divider M
+    pll_range divider = {1, 1};
+    /// Range of the output divider D
+    pll_range output_divider = {1, 1};
+    /// Largest acceptable error of the output frequency, in parts per million
+    double tolerance_ppm = 0;
+    /// Largest number of configurations to return
+    std::size_t max_solutions = 8;
+    /// Number of threads to search with, or zero for one per hardware thread
+    unsigned threads = 0;
+};
+
+/// Synthesizer configuration producing reference * N / (M * D)
+///
+/// The achieved frequency is kept as the exact quotient of two integers counting ticks of \p
+/// Frequency, from which it can be converted to any frequency type.
+///
+/// \tparam Frequency \ref frequencypp::frequency type whose ticks the achieved frequency counts
+template<typename Frequency>
+struct pll_solution
+{
+    /// \ref frequencypp::frequency type whose ticks the achieved frequency counts
+    using frequency_type = Frequency;
+
+    /// Feedback multiplier N
+    std::uint64_t multiplier;
+    /// Reference divider M
+    std::uint64_t divider;
+    /// Output divider D
+    std::uint64_t output_divider;
+    /// Numerator of the achieved frequency in ticks of \p Frequency, which is reference * N
+    uint128_t numerator;
+    /// Denominator of the achieved frequency in ticks of \p Frequency, which is M * D
+    uint128_t denominator;
+    /// Error of the achieved frequency relative to the target, in parts per million
+    double error_ppm;
+
+    /// Get the achieved output frequency, rounded to nearest if the representation of \p
+    /// ToFrequency is integral
+    ///
+    /// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+    /// \return achieved output frequency
+    template<typename ToFrequency = Frequency>
+    [[nodiscard]] auto achieved() const -> ToFrequency;
+
+    /// Get the frequency of the oscillator, which is reference * N / M, rounded to nearest if the
+    /// representation of \p ToFrequency is integral
+    ///
+    /// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+    /// \return frequency of the oscillator
+    template<typename ToFrequency = Frequency>
+    [[nodiscard]] auto vco() const -> ToFrequency;
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+/// Convert the quotient \p num / \p den of tick counts with period \p Period to \p ToFrequency
+template<typename ToFrequency, typename Period>
+auto exact_quotient(uint128_t num, uint128_t den) -> ToFrequency
+{
+    using r = typename std::ratio_divide<Period, typename ToFrequency::period>::type;
+    using rep = typename ToFrequency::rep;
+    if constexpr (std::chrono::treat_as_floating_point_v<rep>) {
+        return ToFrequency{static_cast<rep>(static_cast<long double>(num) * r::num
+            / (static_cast<long double>(den) * r::den))};
+    }
+    else {
+        const auto n = num * static_cast<uint128_t>(r::num);
+        const auto d = den * static_cast<uint128_t>(r::den);
+        return ToFrequency{static_cast<rep>((n + n + d) / (d + d))};
+    }
+}
+
+inline auto absolute_difference(uint128_t a, uint128_t b) noexcept -> uint128_t
+{
+    return a < b ? b - a : a - b;
+}
+
+/// Find the fraction \p p / \p q closest to \p a / \p b whose denominator is no greater than \p
+/// max_q
+///
+/// The closest fraction is the last convergent of the continued fraction of \p a / \p b whose
+/// denominator fits, or the largest semiconvergent after it, as with a descent of the
+/// Stern-Brocot tree. \p b and \p max_q must be positive.
+inline auto best_approximation(uint128_t a, uint128_t b, uint128_t max_q, uint128_t& p,
+    uint128_t& q) noexcept -> void
+{
+    auto x = a;
+    auto y = b;
+    while (y != 0) {
+        const auto rest = x % y;
+        x = y;
+        y = rest;
+    }
+    a /= x;
+    b /= x;
+    if (b <= max_q) {
+        p = a;
+        q = b;
+        return;
+    }
+
+    // Convergents p0 / q0 and p1 / q1, and the remaining fraction n / d
+    auto p0 = uint128_t{0};
+    auto q0 = uint128_t{1};
+    auto p1 = uint128_t{1};
+    auto q1 = uint128_t{0};
+    auto n = a;
+    auto d = b;
+    for (;;) {
+        const auto k = n / d;
+        const auto q2 = q0 + k * q1;
+        if (q2 > max_q) {
+            break;
+        }
+        const auto p2 = p0 + k * p1;
+        p0 = p1;
+        q0 = q1;
+        p1 = p2;
+        q1 = q2;
+        const auto rest = n - k * d;
+        n = d;
+        d = rest;
+    }
+
+    const auto k = (max_q - q0) / q1;
+    const auto ps = p0 + k * p1;
+    const auto qs = q0 + k * q1;
+    // Compare |a / b - ps / qs| with |a / b - p1 / q1| by cross-multiplying
+    if (absolute_difference(a * qs, b * ps) * q1 <= absolute_difference(a * q1, b * p1) * qs) {
+        p = ps;
+        q = qs;
+    }
+    else {
+        p = p1;
+        q = q1;
+    }
+}
+
+/// Exhaustive search of the configurations of one output divider at a time, with exact
+/// arithmetic on tick counts of \p Frequency
+template<typename Frequency>
+struct pll_search
+{
+    using solution = pll_solution<Frequency>;
+
+    // Tolerances are in parts per 10^12
+    static constexpr auto scale = uint128_t{1000000000000};
+
+    uint128_t reference;
+    uint128_t target;
+    uint128_t vco_min;
+    uint128_t vco_max;
+    uint128_t tolerance;
+    pll_constraints constraints;
+
+    /// Determine whether an error of \p deviation ticks out of \p denominator is acceptable,
+    /// where the relative error is \p deviation / (target * \p denominator)
+    [[nodiscard]] auto acceptable(uint128_t deviation, uint128_t denominator) const noexcept
+        -> bool
+    {
+        return deviation * scale <= tolerance * target * denominator;
+    }
+
+    [[nodiscard]] auto deviation(const solution& s) const noexcept -> uint128_t
+    {
+        return absolute_difference(s.numerator, target * s.denominator);
+    }
+
+    /// Order solutions by increasing error, then by increasing division, so that the order is
+    /// total and the results do not depend on how the search is divided
+    [[nodiscard]] auto better(const solution& lhs, const solution& rhs) const noexcept -> bool
+    {
+        const auto l = deviation(lhs) * rhs.denominator;
+        const auto r = deviation(rhs) * lhs.denominator;
+        if (l != r) {
+            return l < r;
+        }
+        if (lhs.denominator != rhs.denominator) {
+            return lhs.denominator < rhs.denominator;
+        }
+        if (lhs.multiplier != rhs.multiplier) {
+            return lhs.multiplier < rhs.multiplier;
+        }
+        return lhs.output_divider < rhs.output_divider;
+    }
+
+    /// Offer \p s to the best solutions kept in the heap \p best, whose worst is at its root
+    ///
+    /// \retval true if \p s was kept
+    /// \retval false if \p s is no better than every kept solution
+    auto offer(std::vector<solution>& best, const solution& s) const -> bool
+    {
+        const auto order = [this](const solution& lhs, const solution& rhs) {
+            return better(lhs, rhs);
+        };
+        if (best.size() == constraints.max_solutions) {
+            if (!better(s, best.front())) {
+                return false;
+            }
+            std::pop_heap(best.begin(), best.end(), order);
+            best.pop_back();
+        }
+        best.push_back(s);
+        std::push_heap(best.begin(), best.end(), order);
+        return true;
+    }
+
+    /// Offer the configuration of \p n, \p m, and \p d to \p best if it is acceptable
+    ///
+    /// \retval true if the configuration is acceptable and was kept
+    /// \retval false otherwise
+    auto try_offer(std::vector<solution>& best, uint128_t n, uint128_t m, uint128_t d) const
+        -> bool
+    {
+        const auto numerator = reference * n;
+        const auto denominator = m * d;
+        const auto exact = target * denominator;
+        if (!acceptable(absolute_difference(numerator, exact), denominator)) {
+            return false;
+        }
+        const auto error = (static_cast<long double>(numerator) - static_cast<long double>(exact))
+            / static_cast<long double>(exact);
+        return offer(best,
+            {static_cast<std::uint64_t>(n), static_cast<std::uint64_t>(m),
+                static_cast<std::uint64_t>(d), numerator, denominator,
+                static_cast<double>(error * 1e6L)});
+    }
+
+    /// Search the output dividers \p first, \p first + \p stride, and so on, up to the largest
+    auto run(std::uint64_t first, std::uint64_t stride, std::vector<solution>& best) const -> void
+    {
+        const auto& c = constraints;
+        const auto n_min = std::max<std::uint64_t>(c.multiplier.min, 1);
+        const auto m_min = std::max<std::uint64_t>(c.divider.min, 1);
+        // Counters are wider than the factors, so that they cannot wrap past the largest
+        for (auto d = uint128_t{first}; d <= c.output_divider.max; d += stride) {
+            // The oscillator must run at about target * d, which must be within its range
+            const auto vco = target * d;
+            if (vco * (scale - std::min(tolerance, scale)) > vco_max * scale
+                || vco * (scale + tolerance) < vco_min * scale)
+            {
+                continue;
+            }
+
+            // No ratio N / M with M in range approximates target * d / reference better than the
+            // closest fraction with a denominator up to the largest M, so if that is unacceptable
+            // then so is every M
+            auto p = uint128_t{0};
+            auto q = uint128_t{0};
+            best_approximation(vco, reference, c.divider.max, p, q);
+            if (!acceptable(absolute_difference(reference * p, vco * q), q * d)) {
+                continue;
+            }
+
+            for (auto m = uint128_t{m_min}; m <= c.divider.max; ++m) {
+                // N is limited by its range and that of the oscillator, reference * N / M
+                const auto lo =
+                    std::max<uint128_t>(n_min, (vco_min * m + reference - 1) / reference);
+                const auto hi = std::min<uint128_t>(c.multiplier.max, vco_max * m / reference);
+                if (lo > hi) {
+                    continue;
+                }
+
+                // The error grows away from the nearest N, so walk outwards from it until
+                // configurations become unacceptable or too poor to keep
+                const auto nearest = std::clamp<uint128_t>(vco * m / reference, lo, hi);
+                for (auto n = nearest; n >= lo; --n) {
+                    if (!try_offer(best, n, m, d)) {
+                        break;
+                    }
+                }
+                for (auto n = nearest + 1; n <= hi; ++n) {
+                    if (!try_offer(best, n, m, d)) {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+template<typename Frequency>
+template<typename ToFrequency>
+auto pll_solution<Frequency>::achieved() const -> ToFrequency
+{
+    return detail::exact_quotient<ToFrequency, typename Frequency::period>(numerator, denominator);
+}
+
+template<typename Frequency>
+template<typename ToFrequency>
+auto pll_solution<Frequency>::vco() const -> ToFrequency
+{
+    return detail::exact_quotient<ToFrequency, typename Frequency::period>(numerator, divider);
+}
+
+/// Plan the factors of a clock synthesizer producing \p target from \p reference
+///
+/// The synthesizer divides the reference by M, multiplies it by N in a phase-locked loop whose
+/// oscillator must run between \p vco_min and \p vco_max, and divides the oscillator by D, to
+/// produce reference * N / (M * D).  Every frequency is converted to the tick counts of their
+/// common type, so that all arithmetic is exact and the units cancel.
+///
+/// Rather than trying every N, M, and D, the search takes each D whose oscillator frequency is in
+/// range and finds the best approximation of the required ratio N / M with the largest M, by
+/// continued fractions.  Values of D for which even that is outside the tolerance are skipped;
+/// for the others, each M is tried with the values of N nearest the required ratio.  Searches of
+/// many configurations are divided between threads by D.
+///
+/// \tparam Rep1 integral type representing the number of ticks for \p reference
+/// \tparam Period1 ratio representing the tick period for \p reference
+/// \tparam Rep2 integral type representing the number of ticks for \p target
+/// \tparam Period2 ratio representing the tick period for \p target
+/// \tparam Rep3 integral type representing the number of ticks for \p vco_min
+/// \tparam Period3 ratio representing the tick period for \p vco_min
+/// \tparam Rep4 integral type representing the number of ticks for \p vco_max
+/// \tparam Period4 ratio representing the tick period for \p vco_max
+/// \param reference frequency of the reference clock, which must be positive
+/// \param target frequency to produce, which must be positive
+/// \param vco_min lowest frequency of the oscillator
+/// \param vco_max highest frequency of the oscillator
+/// \param constraints ranges of the factors and limits on the search
+/// \return acceptable configurations, at most \c constraints.max_solutions of them, with the
+/// smallest error first and ties broken by the smallest M * D
+template<typename Rep1, typename Period1, typename Rep2, typename Period2, typename Rep3,
+    typename Period3, typename Rep4, typename Period4>
+auto plan_pll(const frequency<Rep1, Period1>& reference, const frequency<Rep2, Period2>& target,
+    const frequency<Rep3, Period3>& vco_min, const frequency<Rep4, Period4>& vco_max,
+    const pll_constraints& constraints = {})
+    -> std::vector<pll_solution<std::common_type_t<frequency<Rep1, Period1>,
+        frequency<Rep2, Period2>, frequency<Rep3, Period3>, frequency<Rep4, Period4>>>>
+{
+    static_assert(std::is_integral_v<Rep1> && std::is_integral_v<Rep2> && std::is_integral_v<Rep3>
+            && std::is_integral_v<Rep4>,
+        "Frequencies must have integral tick counts");
+
+    using ct = std::common_type_t<frequency<Rep1, Period1>, frequency<Rep2, Period2>,
+        frequency<Rep3, Period3>, frequency<Rep4, Period4>>;
+    using search_type = detail::pll_search<ct>;
+    using solution = pll_solution<ct>;
+
+    const auto ticks = [](const ct& f) { return static_cast<uint128_t>(f.count()); };
+    const auto tolerance = std::max(std::llround(constraints.tolerance_ppm * 1e6), 0LL);
+    const auto search = search_type{ticks(reference), ticks(target), ticks(vco_min),
+        ticks(vco_max), static_cast<uint128_t>(tolerance), constraints};
+
+    auto best = std::vector<solution>{};
+    const auto d_min = std::max<std::uint64_t>(constraints.output_divider.min, 1);
+    const auto m_min = std::max<std::uint64_t>(constraints.divider.min, 1);
+    const auto n_min = std::max<std::uint64_t>(constraints.multiplier.min, 1);
+    // No factor may be zero, so a range that admits only zero is as empty as an inverted one
+    if (constraints.max_solutions == 0 || d_min > constraints.output_divider.max
+        || m_min > constraints.divider.max || n_min > constraints.multiplier.max
+        || !(reference > ct::zero()) || !(target > ct::zero()))
+    {
+        return best;
+    }
+
+    // Small searches are not worth starting threads for
+    const auto ds = uint128_t{constraints.output_divider.max - d_min} + 1;
+    const auto ms = uint128_t{constraints.divider.max - m_min} + 1;
+    auto threads = static_cast<std::uint64_t>(
+        constraints.threads != 0 ? constraints.threads : std::thread::hardware_concurrency());
+    if (ds * ms < 65536 || threads == 0) {
+        threads = 1;
+    }
+    threads = std::min<std::uint64_t>(threads, static_cast<std::uint64_t>(ds));
+
+    // Output dividers are dealt to the threads in turn, since those that are pruned cost little
+    auto partial = std::vector<std::vector<solution>>(threads);
+    auto workers = std::vector<std::thread>{};
+    for (std::uint64_t i = 1; i < threads; ++i) {
+        workers.emplace_back([&, i]() { search.run(d_min + i, threads, partial[i]); });
+    }
+    search.run(d_min, threads, partial[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& p : partial) {
+        best.insert(best.end(), p.begin(), p.end());
+    }
+    std::sort(best.begin(), best.end(),
+        [&](const solution& lhs, const solution& rhs) { return search.better(lhs, rhs); });
+    if (best.size() > constraints.max_solutions) {
+        best.resize(constraints.max_solutions);
+    }
+    return best;
+}
+
+} // namespace frequencypp
+
+#endif
+
+#endif // FREQUENCYPP_PLL_HPP
@@ -0,0 +1,59 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains explicit instantiation declarations for the SI unit aliases, whose definitions are
+/// compiled into the \c frequencypp::frequencypp_prebuilt library
+///
+/// Linking \c frequencypp::frequencypp_prebuilt defines \c FREQUENCYPP_PREBUILT, which makes
+/// \ref frequency.hpp include this header, so that translation units using the SI units link to
+/// the instantiations in the library instead of instantiating them again.  The stream operators
+/// benefit most.  Functions that are \c constexpr are implicitly inline, so compilers may still
+/// instantiate them for inlining.
+
+#ifndef FREQUENCYPP_PREBUILT_HPP
+#define FREQUENCYPP_PREBUILT_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <ratio>
+
+#include <frequencypp/frequency_core.hpp>
+#include <frequencypp/frequency_io.hpp>
+
+namespace frequencypp {
+
+extern template struct frequency<std::int64_t, std::nano>;
+extern template struct frequency<std::int64_t, std::micro>;
+extern template struct frequency<std::int64_t, std::milli>;
+extern template struct frequency<std::int64_t, std::ratio<1>>;
+extern template struct frequency<std::int64_t, std::kilo>;
+extern template struct frequency<std::int64_t, std::mega>;
+extern template struct frequency<std::int32_t, std::giga>;
+extern template struct frequency<std::int32_t, std::tera>;
+extern template struct frequency<std::int16_t, std::peta>;
+
+extern template auto operator<<(std::ostream& os, const nanohertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const microhertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const millihertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const hertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const kilohertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const megahertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const gigahertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const terahertz& f) -> std::ostream&;
+extern template auto operator<<(std::ostream& os, const petahertz& f) -> std::ostream&;
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_PREBUILT_HPP
@@ -0,0 +1,467 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the saturating integer representation \ref frequencypp::saturating and its associated
+/// specializations
+
+#ifndef FREQUENCYPP_SATURATING_HPP
+#define FREQUENCYPP_SATURATING_HPP
+
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <type_traits>
+
+#include <frequencypp/detail/overflow.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+/// Integer representation whose arithmetic clamps to the limits of \p Int instead of wrapping
+///
+/// A \ref frequencypp::frequency with a saturating representation saturates on increment,
+/// decrement, compound assignment, the free arithmetic operators, and \ref
+/// frequencypp::frequency_cast.  Every operation is computed with the compiler's overflow builtins
+/// and resolves the clamp with a conditional move rather than a branch.  Division by zero remains
+/// undefined, as it is for \p Int.
+///
+/// \tparam Int integral type storing the value
+template<typename Int>
+class saturating
+{
+    static_assert(detail::is_overflow_int_v<Int>, "Int must be a non-bool integral type");
+
+    using limits = std::numeric_limits<Int>;
+
+    Int value_;
+
+    static constexpr auto add(Int a, Int b) noexcept -> Int
+    {
+        Int r{};
+        const auto overflow = detail::add_overflow(a, b, r);
+        return overflow ? detail::saturation_limit(a) : r;
+    }
+
+    static constexpr auto sub(Int a, Int b) noexcept -> Int
+    {
+        Int r{};
+        const auto overflow = detail::sub_overflow(a, b, r);
+        if constexpr (limits::is_signed) {
+            return overflow ? detail::saturation_limit(a) : r;
+        }
+        else {
+            return overflow ? limits::min() : r;
+        }
+    }
+
+    static constexpr auto mul(Int a, Int b) noexcept -> Int
+    {
+        Int r{};
+        const auto overflow = detail::mul_overflow(a, b, r);
+        return overflow ? detail::saturation_limit(static_cast<Int>(a ^ b)) : r;
+    }
+
+    static constexpr auto div(Int a, Int b) noexcept -> Int
+    {
+        if constexpr (limits::is_signed) {
+            // The only overflowing quotient is min / -1, which is diverted to a harmless divisor
+            const auto overflow = (a == limits::min()) & (b == Int{-1});
+            const auto q = static_cast<Int>(a / (overflow ? Int{1} : b));
+            return overflow ? limits::max() : q;
+        }
+        else {
+            return static_cast<Int>(a / b);
+        }
+    }
+
+    static constexpr auto mod(Int a, Int b) noexcept -> Int
+    {
+        if constexpr (limits::is_signed) {
+            const auto overflow = (a == limits::min()) & (b == Int{-1});
+            return static_cast<Int>(a % (overflow ? Int{1} : b));
+        }
+        else {
+            return static_cast<Int>(a % b);
+        }
+    }
+
+public:
+    /// Integral type storing the value
+    using value_type = Int;
+
+    /// Default-construct the value
+    saturating() = default;
+
+    /// Construct the value from integer \p v, clamping it to the limits of \p Int
+    ///
+    /// \tparam T integral type of the value
+    /// \param v value to store
+    template<typename T, typename = std::enable_if_t<detail::is_overflow_int_v<T>>>
+    // Implicit conversions are desired for this constructor, as they enable arithmetic like
+    // f * 2 and construction like frequency<saturating<int>>{5}
+    // NOLINTNEXTLINE
+    constexpr saturating(T v) noexcept
+        : value_(detail::clamp_to<Int>(v))
+    {}
+
+    /// Construct the value from another saturating value \p v, clamping it to the limits of \p Int
+    ///
+    /// \tparam T integral type of the value
+    /// \param v value to store
+    template<typename T>
+    constexpr explicit saturating(saturating<T> v) noexcept
+        : value_(detail::clamp_to<Int>(v.value()))
+    {}
+
+    /// Get the stored value
+    ///
+    /// \return stored value
+    [[nodiscard]] constexpr auto value() const noexcept -> Int
+    {
+        return value_;
+    }
+
+    /// Convert the value to arithmetic type \p T, as if by \c static_cast
+    ///
+    /// \tparam T arithmetic type to convert to
+    template<typename T,
+        typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    constexpr explicit operator T() const noexcept
+    {
+        return static_cast<T>(value_);
+    }
+
+    /// Determine whether the value is nonzero
+    constexpr explicit operator bool() const noexcept
+    {
+        return value_ != 0;
+    }
+
+    constexpr auto operator++() noexcept -> saturating&
+    {
+        value_ = add(value_, Int{1});
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> saturating
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    constexpr auto operator--() noexcept -> saturating&
+    {
+        value_ = sub(value_, Int{1});
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> saturating
+    {
+        auto copy = *this;
+        --*this;
+        return copy;
+    }
+
+    constexpr auto operator+=(saturating rhs) noexcept -> saturating&
+    {
+        value_ = add(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator-=(saturating rhs) noexcept -> saturating&
+    {
+        value_ = sub(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator*=(saturating rhs) noexcept -> saturating&
+    {
+        value_ = mul(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator/=(saturating rhs) noexcept -> saturating&
+    {
+        value_ = div(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator%=(saturating rhs) noexcept -> saturating&
+    {
+        value_ = mod(value_, rhs.value_);
+        return *this;
+    }
+
+    friend constexpr auto operator+(saturating v) noexcept -> saturating
+    {
+        return v;
+    }
+
+    friend constexpr auto operator-(saturating v) noexcept -> saturating
+    {
+        return saturating{sub(Int{0}, v.value_)};
+    }
+
+    friend constexpr auto operator+(saturating lhs, saturating rhs) noexcept -> saturating
+    {
+        return lhs += rhs;
+    }
+
+    friend constexpr auto operator-(saturating lhs, saturating rhs) noexcept -> saturating
+    {
+        return lhs -= rhs;
+    }
+
+    friend constexpr auto operator*(saturating lhs, saturating rhs) noexcept -> saturating
+    {
+        return lhs *= rhs;
+    }
+
+    friend constexpr auto operator/(saturating lhs, saturating rhs) noexcept -> saturating
+    {
+        return lhs /= rhs;
+    }
+
+    friend constexpr auto operator%(saturating lhs, saturating rhs) noexcept -> saturating
+    {
+        return lhs %= rhs;
+    }
+
+    friend constexpr auto operator==(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend constexpr auto operator!=(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend constexpr auto operator<(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ < rhs.value_;
+    }
+
+    friend constexpr auto operator<=(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ <= rhs.value_;
+    }
+
+    friend constexpr auto operator>(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ > rhs.value_;
+    }
+
+    friend constexpr auto operator>=(saturating lhs, saturating rhs) noexcept -> bool
+    {
+        return lhs.value_ >= rhs.value_;
+    }
+
+    /// Inserts the stored value of \p v into \p os
+    template<typename CharT, typename Traits>
+    friend auto operator<<(std::basic_ostream<CharT, Traits>& os, saturating v)
+        -> std::basic_ostream<CharT, Traits>&
+    {
+        // Promote narrow types so that int8_t is not inserted as a character
+        return os << +v.value_;
+    }
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T>
+struct is_saturating : std::false_type
+{};
+
+template<typename Int>
+struct is_saturating<saturating<Int>> : std::true_type
+{};
+
+template<typename T, typename U, typename = void>
+struct saturating_common_type
+{};
+
+template<typename T, typename U>
+struct saturating_common_type<T, U, std::enable_if_t<is_overflow_int_v<U>>>
+{
+    using type = saturating<std::common_type_t<T, U>>;
+};
+
+/// Add \p a and \p b, saturating the sum, using only bitwise operations so that loops over it
+/// are vectorized into packed adds and blends
+template<typename Int>
+constexpr auto saturating_add_bits(Int a, Int b) noexcept -> Int
+{
+    using uint = std::make_unsigned_t<Int>;
+    const auto r = static_cast<Int>(static_cast<uint>(a) + static_cast<uint>(b));
+    if constexpr (std::is_signed_v<Int>) {
+        const auto mask = static_cast<Int>(
+            static_cast<Int>((a ^ r) & (b ^ r)) >> std::numeric_limits<Int>::digits);
+        return static_cast<Int>(r ^ ((r ^ saturation_limit(a)) & mask));
+    }
+    else {
+        return static_cast<Int>(r | static_cast<Int>(uint{0} - (r < a)));
+    }
+}
+
+/// Subtract \p b from \p a, saturating the difference, using only bitwise operations so that
+/// loops over it are vectorized into packed subtracts and blends
+template<typename Int>
+constexpr auto saturating_sub_bits(Int a, Int b) noexcept -> Int
+{
+    using uint = std::make_unsigned_t<Int>;
+    const auto r = static_cast<Int>(static_cast<uint>(a) - static_cast<uint>(b));
+    if constexpr (std::is_signed_v<Int>) {
+        const auto mask = static_cast<Int>(
+            static_cast<Int>((a ^ b) & (a ^ r)) >> std::numeric_limits<Int>::digits);
+        return static_cast<Int>(r ^ ((r ^ saturation_limit(a)) & mask));
+    }
+    else {
+        return static_cast<Int>(r & static_cast<Int>(uint{0} - (b <= a)));
+    }
+}
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::common_type for two \ref frequencypp::saturating types
+template<typename T, typename U>
+struct std::common_type<frequencypp::saturating<T>, frequencypp::saturating<U>>
+{
+    /// Saturating type over the common type of \p T and \p U
+    using type = frequencypp::saturating<std::common_type_t<T, U>>;
+};
+
+/// Specialization of std::common_type for a \ref frequencypp::saturating type and an integral type
+template<typename T, typename U>
+struct std::common_type<frequencypp::saturating<T>, U>
+    : frequencypp::detail::saturating_common_type<T, U>
+{};
+
+/// Specialization of std::common_type for an integral type and a \ref frequencypp::saturating type
+template<typename T, typename U>
+struct std::common_type<U, frequencypp::saturating<T>>
+    : frequencypp::detail::saturating_common_type<T, U>
+{};
+
+/// Specialization of std::numeric_limits for \ref frequencypp::saturating
+template<typename Int>
+class std::numeric_limits<frequencypp::saturating<Int>> : public std::numeric_limits<Int>
+{
+public:
+    static constexpr auto min() noexcept -> frequencypp::saturating<Int>
+    {
+        return std::numeric_limits<Int>::min();
+    }
+
+    static constexpr auto lowest() noexcept -> frequencypp::saturating<Int>
+    {
+        return std::numeric_limits<Int>::lowest();
+    }
+
+    static constexpr auto max() noexcept -> frequencypp::saturating<Int>
+    {
+        return std::numeric_limits<Int>::max();
+    }
+};
+
+namespace frequencypp {
+
+/// Specialization of \ref frequencypp::frequency_values for \ref frequencypp::saturating, whose
+/// extremes are the limits that arithmetic clamps to
+///
+/// \tparam Int integral type storing the value
+template<typename Int>
+struct frequency_values<saturating<Int>>
+{
+    /// Gets the zero-length representation
+    ///
+    /// \return zero-length representation
+    static constexpr auto zero() noexcept -> saturating<Int>
+    {
+        return Int{0};
+    }
+
+    /// Gets the smallest possible representation
+    ///
+    /// \return smallest possible representation
+    static constexpr auto min() noexcept -> saturating<Int>
+    {
+        return std::numeric_limits<Int>::min();
+    }
+
+    /// Gets the largest possible representation
+    ///
+    /// \return largest possible representation
+    static constexpr auto max() noexcept -> saturating<Int>
+    {
+        return std::numeric_limits<Int>::max();
+    }
+};
+
+/// Add the frequencies of \p lhs and \p rhs element-wise into \p out, saturating each sum
+///
+/// The loop is free of branches and is vectorized by the compiler.  \p out may alias \p lhs or
+/// \p rhs.
+///
+/// \tparam Int integral type storing the tick counts
+/// \tparam Period ratio representing the tick period
+/// \param lhs left-hand frequencies to add
+/// \param rhs right-hand frequencies to add
+/// \param out frequencies to store the sums in
+/// \param n number of frequencies in each of \p lhs, \p rhs, and \p out
+template<typename Int, typename Period>
+void saturating_add(const frequency<saturating<Int>, Period>* lhs,
+    const frequency<saturating<Int>, Period>* rhs,
+    frequency<saturating<Int>, Period>* out,
+    std::size_t n) noexcept
+{
+    using f = frequency<saturating<Int>, Period>;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = f{saturating<Int>{
+            detail::saturating_add_bits(lhs[i].count().value(), rhs[i].count().value())}};
+    }
+}
+
+/// Subtract the frequencies of \p rhs from \p lhs element-wise into \p out, saturating each
+/// difference
+///
+/// The loop is free of branches and is vectorized by the compiler.  \p out may alias \p lhs or
+/// \p rhs.
+///
+/// \tparam Int integral type storing the tick counts
+/// \tparam Period ratio representing the tick period
+/// \param lhs left-hand frequencies to subtract from
+/// \param rhs right-hand frequencies to subtract
+/// \param out frequencies to store the differences in
+/// \param n number of frequencies in each of \p lhs, \p rhs, and \p out
+template<typename Int, typename Period>
+void saturating_sub(const frequency<saturating<Int>, Period>* lhs,
+    const frequency<saturating<Int>, Period>* rhs,
+    frequency<saturating<Int>, Period>* out,
+    std::size_t n) noexcept
+{
+    using f = frequency<saturating<Int>, Period>;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = f{saturating<Int>{
+            detail::saturating_sub_bits(lhs[i].count().value(), rhs[i].count().value())}};
+    }
+}
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_SATURATING_HPP
@@ -0,0 +1,593 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the portable vector representation \ref frequencypp::simd, which holds several tick
+/// counts in one frequency, and its mask type \ref frequencypp::simd_mask
+
+#ifndef FREQUENCYPP_SIMD_HPP
+#define FREQUENCYPP_SIMD_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#include <frequencypp/detail/attributes.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FREQUENCYPP_HAS_SIMD 1
+#else
+#define FREQUENCYPP_HAS_SIMD 0
+#endif
+
+#if FREQUENCYPP_HAS_SIMD
+
+// Vectors wider than the registers of the target are passed in memory, about which GCC warns
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace frequencypp {
+
+template<typename T, std::size_t N>
+class simd;
+
+/// Result of a lane-wise comparison of two \ref frequencypp::simd values, with one flag per lane
+///
+/// \tparam T arithmetic type of the lanes of the compared values
+/// \tparam N number of lanes
+template<typename T, std::size_t N>
+class simd_mask
+{
+public:
+    /// Vector extension type storing the flags, whose lanes are all ones if set and zero otherwise
+    using native_type =
+        decltype(typename simd<T, N>::native_type{} < typename simd<T, N>::native_type{});
+
+private:
+    native_type m_;
+
+public:
+    /// Default-construct the mask
+    simd_mask() = default;
+
+    /// Construct the mask with every lane set to \p b
+    ///
+    /// \param b value of every lane
+    FREQUENCYPP_INLINE constexpr explicit simd_mask(bool b) noexcept
+        : m_(native_type{} - static_cast<int>(b))
+    {}
+
+    /// Construct the mask from vector extension value \p m
+    ///
+    /// \param m flags, whose lanes must each be all ones or zero
+    FREQUENCYPP_INLINE constexpr explicit simd_mask(native_type m) noexcept
+        : m_(m)
+    {}
+
+    /// Construct the mask from mask \p m over lanes of another type
+    ///
+    /// \tparam U arithmetic type of the lanes compared by \p m
+    /// \param m flags to convert
+    template<typename U>
+    FREQUENCYPP_INLINE constexpr explicit simd_mask(const simd_mask<U, N>& m) noexcept
+        : m_(__builtin_convertvector(m.native(), native_type))
+    {}
+
+    /// Get the number of lanes
+    ///
+    /// \return number of lanes
+    FREQUENCYPP_INLINE static constexpr auto size() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    /// Get the flags as a vector extension value
+    ///
+    /// \return flags
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto native() const noexcept -> native_type
+    {
+        return m_;
+    }
+
+    /// Get the flag of lane \p i
+    ///
+    /// \param i lane to read
+    /// \return whether lane \p i is set
+    FREQUENCYPP_INLINE constexpr auto operator[](std::size_t i) const noexcept -> bool
+    {
+        return m_[i] != 0;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator!(simd_mask m) noexcept -> simd_mask
+    {
+        return simd_mask{~m.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator&&(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ & rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator||(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ | rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator&(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ & rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator|(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ | rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator^(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ ^ rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator==(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ == rhs.m_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator!=(simd_mask lhs, simd_mask rhs) noexcept
+        -> simd_mask
+    {
+        return simd_mask{lhs.m_ != rhs.m_};
+    }
+};
+
+/// Determine whether every lane of mask \p m is set
+///
+/// \param m mask to inspect
+/// \retval true if every lane is set
+/// \retval false if any lane is not set
+template<typename T, std::size_t N>
+FREQUENCYPP_INLINE constexpr auto all_of(const simd_mask<T, N>& m) noexcept -> bool
+{
+    auto all = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        all &= m[i];
+    }
+    return all;
+}
+
+/// Determine whether any lane of mask \p m is set
+///
+/// \param m mask to inspect
+/// \retval true if any lane is set
+/// \retval false if no lane is set
+template<typename T, std::size_t N>
+FREQUENCYPP_INLINE constexpr auto any_of(const simd_mask<T, N>& m) noexcept -> bool
+{
+    auto any = false;
+    for (std::size_t i = 0; i < N; ++i) {
+        any |= m[i];
+    }
+    return any;
+}
+
+/// Determine whether no lane of mask \p m is set
+///
+/// \param m mask to inspect
+/// \retval true if no lane is set
+/// \retval false if any lane is set
+template<typename T, std::size_t N>
+FREQUENCYPP_INLINE constexpr auto none_of(const simd_mask<T, N>& m) noexcept -> bool
+{
+    return !any_of(m);
+}
+
+/// Vector representation holding \p N values of type \p T, which are operated on lane-wise
+///
+/// A \ref frequencypp::frequency whose representation is a \ref frequencypp::simd holds \p N tick
+/// counts of the same period, so that one unit-safe expression converts, adds, or compares all of
+/// them at once using the vector instructions of the target.  The values are stored in a GCC and
+/// Clang vector extension type, so this representation is available only with those compilers.
+///
+/// Scalars convert implicitly to vectors with every lane set to the scalar, so that arithmetic like
+/// f * 2 applies to every lane.  Comparisons return a \ref frequencypp::simd_mask, as do the
+/// comparisons of frequencies with this representation, and \ref frequencypp::floor, \ref
+/// frequencypp::ceil, \ref frequencypp::round, and \ref frequencypp::abs apply lane-wise.
+///
+/// \tparam T arithmetic type of each lane
+/// \tparam N number of lanes, which must be a power of two
+template<typename T, std::size_t N>
+class simd
+{
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+        "T must be a non-bool arithmetic type");
+    static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+    /// Arithmetic type of each lane
+    using value_type = T;
+    /// Type of the result of lane-wise comparisons
+    using mask_type = simd_mask<T, N>;
+    /// Vector extension type storing the lanes
+    using native_type [[gnu::vector_size(sizeof(T) * N)]] = T;
+
+private:
+    native_type v_;
+
+public:
+    /// Default-construct the value
+    simd() = default;
+
+    /// Construct the value with every lane set to \p x
+    ///
+    /// \tparam U arithmetic type of the value
+    /// \param x value of every lane
+    template<typename U, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    // Implicit conversions are desired for this constructor, as they enable arithmetic like
+    // f * 2 and construction like frequency<simd<int, 4>>{5}
+    // NOLINTNEXTLINE
+    FREQUENCYPP_INLINE constexpr simd(U x) noexcept
+        : v_(native_type{} + static_cast<T>(x))
+    {}
+
+    /// Construct the value from vector extension value \p v
+    ///
+    /// \param v lanes
+    FREQUENCYPP_INLINE constexpr explicit simd(native_type v) noexcept
+        : v_(v)
+    {}
+
+    /// Construct the value by converting each lane of \p v, as if by \c static_cast
+    ///
+    /// \tparam U arithmetic type of the lanes of \p v
+    /// \param v value to convert
+    template<typename U>
+    FREQUENCYPP_INLINE constexpr explicit simd(const simd<U, N>& v) noexcept
+        : v_(__builtin_convertvector(v.native(), native_type))
+    {}
+
+    /// Construct the value with lane \c i set to \p gen(i)
+    ///
+    /// \tparam Generator type of a callable taking the index of a lane
+    /// \param gen callable producing the value of each lane
+    template<typename Generator,
+        typename = std::enable_if_t<std::is_invocable_v<Generator&, std::size_t>>>
+    constexpr explicit simd(Generator&& gen)
+        : v_()
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            v_[i] = static_cast<T>(gen(i));
+        }
+    }
+
+    /// Get the number of lanes
+    ///
+    /// \return number of lanes
+    FREQUENCYPP_INLINE static constexpr auto size() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    /// Load the value from the \p N consecutive values at \p p, which need not be aligned
+    ///
+    /// \param p values to load
+    FREQUENCYPP_INLINE auto copy_from(const T* p) noexcept -> void
+    {
+        std::memcpy(&v_, p, sizeof(v_));
+    }
+
+    /// Store the value to the \p N consecutive values at \p p, which need not be aligned
+    ///
+    /// \param p values to store to
+    FREQUENCYPP_INLINE auto copy_to(T* p) const noexcept -> void
+    {
+        std::memcpy(p, &v_, sizeof(v_));
+    }
+
+    /// Get the lanes as a vector extension value
+    ///
+    /// \return lanes
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto native() const noexcept -> native_type
+    {
+        return v_;
+    }
+
+    /// Get the value of lane \p i
+    ///
+    /// \param i lane to read
+    /// \return value of lane \p i
+    FREQUENCYPP_INLINE constexpr auto operator[](std::size_t i) const noexcept -> T
+    {
+        return v_[i];
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator++() noexcept -> simd&
+    {
+        v_ += T{1};
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator++(int) noexcept -> simd
+    {
+        auto copy = *this;
+        v_ += T{1};
+        return copy;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator--() noexcept -> simd&
+    {
+        v_ -= T{1};
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator--(int) noexcept -> simd
+    {
+        auto copy = *this;
+        v_ -= T{1};
+        return copy;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator+=(simd rhs) noexcept -> simd&
+    {
+        v_ += rhs.v_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator-=(simd rhs) noexcept -> simd&
+    {
+        v_ -= rhs.v_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator*=(simd rhs) noexcept -> simd&
+    {
+        v_ *= rhs.v_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator/=(simd rhs) noexcept -> simd&
+    {
+        v_ /= rhs.v_;
+        return *this;
+    }
+
+    template<typename U = T, typename = std::enable_if_t<std::is_integral_v<U>>>
+    FREQUENCYPP_INLINE constexpr auto operator%=(simd rhs) noexcept -> simd&
+    {
+        v_ %= rhs.v_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator+(simd v) noexcept -> simd
+    {
+        return v;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator-(simd v) noexcept -> simd
+    {
+        return simd{-v.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator+(simd lhs, simd rhs) noexcept -> simd
+    {
+        return simd{lhs.v_ + rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator-(simd lhs, simd rhs) noexcept -> simd
+    {
+        return simd{lhs.v_ - rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator*(simd lhs, simd rhs) noexcept -> simd
+    {
+        return simd{lhs.v_ * rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator/(simd lhs, simd rhs) noexcept -> simd
+    {
+        return simd{lhs.v_ / rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator%(simd lhs, simd rhs) noexcept -> simd
+    {
+        return lhs %= rhs;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator==(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ == rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator!=(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ != rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator<(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ < rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator<=(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ <= rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator>(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ > rhs.v_};
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator>=(simd lhs, simd rhs) noexcept -> mask_type
+    {
+        return mask_type{lhs.v_ >= rhs.v_};
+    }
+
+    /// Inserts the lanes of \p v into \p os, separated by commas and enclosed in braces
+    template<typename CharT, typename Traits>
+    friend auto operator<<(std::basic_ostream<CharT, Traits>& os, const simd& v)
+        -> std::basic_ostream<CharT, Traits>&
+    {
+        os << '{';
+        for (std::size_t i = 0; i < N; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+            // Promote narrow types so that int8_t is not inserted as a character
+            os << +v[i];
+        }
+        return os << '}';
+    }
+};
+
+/// Specialization of \ref frequencypp::frequency_select for \ref frequencypp::simd_mask, which
+/// chooses lane by lane
+///
+/// \tparam T arithmetic type of the lanes of the compared values
+/// \tparam N number of lanes
+template<typename T, std::size_t N>
+struct frequency_select<simd_mask<T, N>>
+{
+    /// Chooses each lane of \p a where that lane of \p m is set, and of \p b elsewhere
+    ///
+    /// \tparam U arithmetic type of the lanes of the tick counts
+    /// \param m comparison result
+    /// \param a tick counts to choose where \p m is set
+    /// \param b tick counts to choose where \p m is not set
+    /// \return tick counts chosen from \p a and \p b
+    template<typename U>
+    FREQUENCYPP_INLINE static constexpr auto select(
+        const simd_mask<T, N>& m, const simd<U, N>& a, const simd<U, N>& b) noexcept -> simd<U, N>
+    {
+        // Masks of lanes of other widths are converted, which keeps each lane all ones or zero
+        const auto mask = simd_mask<U, N>{m}.native();
+        return simd<U, N>{mask ? a.native() : b.native()};
+    }
+};
+
+/// Specialization of \ref frequencypp::frequency_values for \ref frequencypp::simd, which sets
+/// every lane
+///
+/// \tparam T arithmetic type of each lane
+/// \tparam N number of lanes
+template<typename T, std::size_t N>
+struct frequency_values<simd<T, N>>
+{
+    /// Gets the zero-length representation
+    ///
+    /// \return zero-length representation
+    FREQUENCYPP_INLINE static constexpr auto zero() noexcept -> simd<T, N>
+    {
+        return T{0};
+    }
+
+    /// Gets the smallest possible representation
+    ///
+    /// \return smallest possible representation
+    FREQUENCYPP_INLINE static constexpr auto min() noexcept -> simd<T, N>
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    /// Gets the largest possible representation
+    ///
+    /// \return largest possible representation
+    FREQUENCYPP_INLINE static constexpr auto max() noexcept -> simd<T, N>
+    {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T, std::size_t N, typename U, typename = void>
+struct simd_common_type
+{};
+
+template<typename T, std::size_t N, typename U>
+struct simd_common_type<T, N, U, std::enable_if_t<std::is_arithmetic_v<U>>>
+{
+    using type = simd<std::common_type_t<T, U>, N>;
+};
+
+} // namespace frequencypp::detail
+
+/// Specialization of std::common_type for two \ref frequencypp::simd types of the same width
+template<typename T, typename U, std::size_t N>
+struct std::common_type<frequencypp::simd<T, N>, frequencypp::simd<U, N>>
+{
+    /// Vector type over the common type of \p T and \p U
+    using type = frequencypp::simd<std::common_type_t<T, U>, N>;
+};
+
+/// Specialization of std::common_type for a \ref frequencypp::simd type and an arithmetic type
+template<typename T, std::size_t N, typename U>
+struct std::common_type<frequencypp::simd<T, N>, U>
+    : frequencypp::detail::simd_common_type<T, N, U>
+{};
+
+/// Specialization of std::common_type for an arithmetic type and a \ref frequencypp::simd type
+template<typename U, typename T, std::size_t N>
+struct std::common_type<U, frequencypp::simd<T, N>>
+    : frequencypp::detail::simd_common_type<T, N, U>
+{};
+
+/// Specialization of std::numeric_limits for \ref frequencypp::simd, whose limits set every lane
+template<typename T, std::size_t N>
+class std::numeric_limits<frequencypp::simd<T, N>> : public std::numeric_limits<T>
+{
+public:
+    static constexpr auto min() noexcept -> frequencypp::simd<T, N>
+    {
+        return std::numeric_limits<T>::min();
+    }
+
+    static constexpr auto lowest() noexcept -> frequencypp::simd<T, N>
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    static constexpr auto max() noexcept -> frequencypp::simd<T, N>
+    {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+/// Specialization of std::chrono::treat_as_floating_point for \ref frequencypp::simd, which
+/// follows the type of its lanes
+template<typename T, std::size_t N>
+struct std::chrono::treat_as_floating_point<frequencypp::simd<T, N>>
+    : std::chrono::treat_as_floating_point<T>
+{};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+#endif // FREQUENCYPP_SIMD_HPP
@@ -0,0 +1,223 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the hardware counter clock \ref frequencypp::tick_clock, whose tick period is derived
+/// from a compile-time frequency, and counter sources for common hardware
+
+#ifndef FREQUENCYPP_TICK_CLOCK_HPP
+#define FREQUENCYPP_TICK_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace frequencypp {
+
+/// Compile-time frequency of \p Count ticks of \p Frequency, for use as the rate of a \ref
+/// frequencypp::tick_clock
+///
+/// \tparam Frequency \ref frequencypp::frequency type of the value
+/// \tparam Count tick count of the value
+template<typename Frequency, typename Frequency::rep Count>
+struct frequency_constant
+{
+    static_assert(detail::is_frequency_v<Frequency>, "Frequency must be a frequency");
+    static_assert(Count > 0, "Count must be positive");
+
+    /// \ref frequencypp::frequency type of the value
+    using value_type = Frequency;
+
+    /// The frequency
+    static constexpr auto value = Frequency{Count};
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T>
+struct is_frequency_constant : std::false_type
+{};
+
+template<typename Frequency, typename Frequency::rep Count>
+struct is_frequency_constant<frequency_constant<Frequency, Count>> : std::true_type
+{};
+
+template<typename Source, typename = void>
+struct has_read_relaxed : std::false_type
+{};
+
+template<typename Source>
+struct has_read_relaxed<Source, std::void_t<decltype(Source::read_relaxed())>> : std::true_type
+{};
+
+template<typename Source, typename = void>
+struct source_is_steady : std::false_type
+{};
+
+template<typename Source>
+struct source_is_steady<Source, std::void_t<decltype(Source::is_steady)>>
+    : std::bool_constant<Source::is_steady>
+{};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Clock satisfying the \c std::chrono \c Clock requirements whose ticks are the raw readings of a
+/// hardware counter running at frequency \p Frequency
+///
+/// The tick period is the reciprocal of the counter frequency and is computed at compile time, so
+/// converting a \ref frequencypp::tick_clock::duration to any other \c std::chrono::duration is
+/// ratio arithmetic folded by the compiler rather than a runtime division by a measured rate.
+///
+/// \p Source must provide a static \c read() function returning the current raw counter value.  It
+/// may additionally provide:
+///
+/// - a static \c read_relaxed() function returning the counter value without the ordering
+///   guarantees of \c read(), which is used by \ref frequencypp::tick_clock::now_relaxed; and
+/// - a static constant \c is_steady, which defaults to \c false.
+///
+/// \tparam Frequency \ref frequencypp::frequency_constant giving the counter frequency
+/// \tparam Source counter source to read ticks from
+template<typename Frequency, typename Source>
+struct tick_clock
+{
+    static_assert(detail::is_frequency_constant<Frequency>::value,
+        "Frequency must be a frequency_constant");
+    static_assert(std::is_integral_v<typename Frequency::value_type::rep>,
+        "Frequency must have an integral tick count");
+
+    /// Arithmetic type representing the number of ticks
+    using rep = std::int64_t;
+    /// Ratio representing the tick period, which is the reciprocal of the counter frequency
+    using period = typename std::ratio_divide<std::ratio<1>,
+        std::ratio_multiply<typename Frequency::value_type::period,
+            std::ratio<static_cast<std::intmax_t>(Frequency::value.count())>>>::type;
+    /// Duration of the clock
+    using duration = std::chrono::duration<rep, period>;
+    /// Time point of the clock
+    using time_point = std::chrono::time_point<tick_clock>;
+
+    /// Whether the counter never decreases and ticks at a constant rate
+    static constexpr bool is_steady = detail::source_is_steady<Source>::value;
+
+    /// Get the frequency of the counter
+    ///
+    /// \return frequency of the counter
+    static constexpr auto rate() noexcept -> typename Frequency::value_type
+    {
+        return Frequency::value;
+    }
+
+    /// Get the current time point of the counter
+    ///
+    /// \return current time point
+    static auto now() noexcept -> time_point
+    {
+        return time_point{duration{static_cast<rep>(Source::read())}};
+    }
+
+    /// Get the current time point of the counter using the cheapest read \p Source offers
+    ///
+    /// The read may be reordered with respect to surrounding instructions, so it is intended for
+    /// hot paths that timestamp many events and tolerate skew of a few cycles.
+    ///
+    /// \return current time point
+    static auto now_relaxed() noexcept -> time_point
+    {
+        if constexpr (detail::has_read_relaxed<Source>::value) {
+            return time_point{duration{static_cast<rep>(Source::read_relaxed())}};
+        }
+        else {
+            return now();
+        }
+    }
+};
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+/// Counter source reading the x86 time-stamp counter, which is steady on processors with an
+/// invariant TSC
+struct x86_tsc_source
+{
+    static constexpr bool is_steady = true;
+
+    /// Read the counter after all preceding instructions have executed, using \c rdtscp
+    static auto read() noexcept -> std::uint64_t
+    {
+#if defined(_MSC_VER)
+        unsigned int aux = 0;
+        return __rdtscp(&aux);
+#else
+        std::uint32_t lo = 0;
+        std::uint32_t hi = 0;
+        __asm__ __volatile__("rdtscp" : "=a"(lo), "=d"(hi)::"rcx");
+        return (std::uint64_t{hi} << 32) | lo;
+#endif
+    }
+
+    /// Read the counter without waiting for preceding instructions, using \c rdtsc
+    static auto read_relaxed() noexcept -> std::uint64_t
+    {
+#if defined(_MSC_VER)
+        return __rdtsc();
+#else
+        std::uint32_t lo = 0;
+        std::uint32_t hi = 0;
+        __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+        return (std::uint64_t{hi} << 32) | lo;
+#endif
+    }
+};
+
+#endif
+
+#if defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+
+/// Counter source reading the AArch64 generic timer virtual count register
+struct aarch64_cntvct_source
+{
+    static constexpr bool is_steady = true;
+
+    /// Read the counter after all preceding instructions have executed
+    static auto read() noexcept -> std::uint64_t
+    {
+        std::uint64_t v = 0;
+        __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(v)::"memory");
+        return v;
+    }
+
+    /// Read the counter without an instruction barrier
+    static auto read_relaxed() noexcept -> std::uint64_t
+    {
+        std::uint64_t v = 0;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+        return v;
+    }
+};
+
+#endif
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_TICK_CLOCK_HPP
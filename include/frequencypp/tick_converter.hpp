@@ -0,0 +1,256 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains the multiply-shift converter \ref frequencypp::tick_converter between counter ticks at
+/// a runtime frequency and \c std::chrono durations
+
+#ifndef FREQUENCYPP_TICK_CONVERTER_HPP
+#define FREQUENCYPP_TICK_CONVERTER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp::detail {
+
+/// Multiplier and shift approximating a ratio \c r as \c mult / 2^shift over inputs up to \c limit
+struct mult_shift
+{
+    std::uint64_t mult;
+    int shift;
+    std::uint64_t limit;
+
+    /// Choose the largest shift whose multiplier keeps \c limit * mult, plus the rounding bias,
+    /// within 64 bits
+    ///
+    /// If no shift does so for \p range, the range is shrunk to what the multiplier allows at the
+    /// finest shift at which it is nonzero, and is zero if \p r has no multiplier at all.
+    static auto calculate(long double r, long double range) noexcept -> mult_shift
+    {
+        constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+        const auto limit = std::max(std::ceil(range), 1.0L);
+        const auto l =
+            limit >= static_cast<long double>(max) ? max : static_cast<std::uint64_t>(limit);
+        for (auto shift = 63; shift > 0; --shift) {
+            const auto m = std::round(std::ldexp(r, shift));
+            const auto bias = std::uint64_t{1} << (shift - 1);
+            if (m >= 1.0L && m <= static_cast<long double>((max - bias) / l)) {
+                return {static_cast<std::uint64_t>(m), shift, l};
+            }
+        }
+
+        // A ratio of at least one half needs no shift, and a smaller one needs the finest
+        const auto shift = std::round(r) >= 1.0L ? 0 : 63;
+        const auto m = std::round(std::ldexp(r, shift));
+        if (m < 1.0L || m > static_cast<long double>(max)) {
+            return {0, 0, 0};
+        }
+        const auto mult = static_cast<std::uint64_t>(m);
+        const auto bias = shift == 0 ? 0 : std::uint64_t{1} << (shift - 1);
+        return {mult, shift, std::min(l, (max - bias) / mult)};
+    }
+
+    [[nodiscard]] auto bias() const noexcept -> std::uint64_t
+    {
+        return shift == 0 ? 0 : std::uint64_t{1} << (shift - 1);
+    }
+
+    /// Multiply \p v by \c mult and shift the product, rounding to nearest
+    [[nodiscard]] auto apply(std::uint64_t v) const noexcept -> std::uint64_t
+    {
+        return (v * mult + bias()) >> shift;
+    }
+
+    /// Bound the absolute error of \ref apply for inputs up to \c limit against exact ratio \p r
+    [[nodiscard]] auto error(long double r) const noexcept -> std::uint64_t
+    {
+        const auto approx = std::ldexp(static_cast<long double>(mult), -shift);
+        // Rounding of the multiplier accumulates over the range, and the shift rounds once
+        return static_cast<std::uint64_t>(
+                   std::ceil(static_cast<long double>(limit) * std::fabs(approx - r)))
+            + 1;
+    }
+};
+
+} // namespace frequencypp::detail
+
+namespace frequencypp {
+
+/// Converts between raw counter ticks at a frequency known only at runtime and durations of type
+/// \p Duration, without dividing
+///
+/// As with the Linux clocksource framework, each direction of the conversion is precomputed as a
+/// multiplier and a shift, so that converting a tick count is a 64-bit multiply, add, and shift
+/// instead of a 64-bit division.  Results are rounded to the nearest unit.  The shift is chosen
+/// as large as possible, which minimizes the error, such that the product cannot overflow for any
+/// input within the range given at construction.  Callers that convert timestamps spanning longer
+/// than the range should convert deltas from a recent base instead.  If a ratio is too large or
+/// too small for a multiplier to cover the range, the range is shrunk to what it does cover, which
+/// \ref frequencypp::tick_converter::max_ticks and \ref frequencypp::tick_converter::max_duration
+/// report and which is zero if the ratio cannot be represented at all.
+///
+/// \tparam Duration \c std::chrono::duration type with an integral tick count to convert to and
+/// from
+template<typename Duration = std::chrono::nanoseconds>
+class tick_converter
+{
+    static_assert(detail::is_duration_v<Duration>, "Duration must be a duration");
+    static_assert(std::is_integral_v<typename Duration::rep>, "Duration must have an integral rep");
+
+    using rep = typename Duration::rep;
+    using period = typename Duration::period;
+
+    long double ratio_; // Units of Duration per tick
+    detail::mult_shift to_duration_;
+    detail::mult_shift to_ticks_;
+
+    template<typename Rep, typename Period>
+    static auto units_per_tick(const frequency<Rep, Period>& f) noexcept -> long double
+    {
+        // One tick lasts 1 / (count * Period) seconds, which is that times
+        // period::den / period::num units of Duration
+        return static_cast<long double>(Period::den) * static_cast<long double>(period::den)
+            / (static_cast<long double>(f.count()) * static_cast<long double>(Period::num)
+                * static_cast<long double>(period::num));
+    }
+
+public:
+    /// Construct a converter for a counter running at frequency \p f, whose conversions are exact
+    /// to within \ref frequencypp::tick_converter::max_error for spans up to \p range
+    ///
+    /// \tparam Rep arithmetic type representing the number of ticks for \p f
+    /// \tparam Period ratio representing the tick period for \p f
+    /// \param f frequency of the counter, which must be positive
+    /// \param range longest span that is converted without overflow, which must be positive
+    template<typename Rep, typename Period>
+    explicit tick_converter(
+        const frequency<Rep, Period>& f, Duration range = std::chrono::minutes{10}) noexcept
+        : ratio_(units_per_tick(f))
+        , to_duration_(detail::mult_shift::calculate(
+              ratio_, static_cast<long double>(range.count()) / ratio_))
+        , to_ticks_(detail::mult_shift::calculate(
+              1.0L / ratio_, static_cast<long double>(range.count())))
+    {}
+
+    /// Convert tick count \p ticks to a duration
+    ///
+    /// \param ticks tick count no greater than \ref frequencypp::tick_converter::max_ticks
+    /// \return duration of \p ticks ticks
+    [[nodiscard]] auto to_duration(std::uint64_t ticks) const noexcept -> Duration
+    {
+        return Duration{static_cast<rep>(to_duration_.apply(ticks))};
+    }
+
+    /// Convert duration \p d to a tick count
+    ///
+    /// \param d non-negative duration no longer than \ref frequencypp::tick_converter::max_duration
+    /// \return number of ticks in \p d
+    [[nodiscard]] auto to_ticks(Duration d) const noexcept -> std::uint64_t
+    {
+        return to_ticks_.apply(static_cast<std::uint64_t>(d.count()));
+    }
+
+    /// Convert the \p n tick counts of \p ticks to durations in \p out
+    ///
+    /// \param ticks tick counts no greater than \ref frequencypp::tick_converter::max_ticks
+    /// \param out durations to store the results in
+    /// \param n number of values in each of \p ticks and \p out
+    void to_duration(const std::uint64_t* ticks, Duration* out, std::size_t n) const noexcept
+    {
+        const auto m = to_duration_.mult;
+        const auto b = to_duration_.bias();
+        const auto s = to_duration_.shift;
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Duration{static_cast<rep>((ticks[i] * m + b) >> s)};
+        }
+    }
+
+    /// Convert the \p n durations of \p ds to tick counts in \p out
+    ///
+    /// \param ds non-negative durations no longer than \ref
+    /// frequencypp::tick_converter::max_duration
+    /// \param out tick counts to store the results in
+    /// \param n number of values in each of \p ds and \p out
+    void to_ticks(const Duration* ds, std::uint64_t* out, std::size_t n) const noexcept
+    {
+        const auto m = to_ticks_.mult;
+        const auto b = to_ticks_.bias();
+        const auto s = to_ticks_.shift;
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = (static_cast<std::uint64_t>(ds[i].count()) * m + b) >> s;
+        }
+    }
+
+    /// Get the multiplier applied to tick counts
+    ///
+    /// \return multiplier applied to tick counts
+    [[nodiscard]] auto mult() const noexcept -> std::uint64_t
+    {
+        return to_duration_.mult;
+    }
+
+    /// Get the shift applied to the products of tick counts and \ref
+    /// frequencypp::tick_converter::mult
+    ///
+    /// \return shift applied to products of tick counts
+    [[nodiscard]] auto shift() const noexcept -> int
+    {
+        return to_duration_.shift;
+    }
+
+    /// Get the largest tick count that converts without overflow
+    ///
+    /// \return largest tick count that converts without overflow
+    [[nodiscard]] auto max_ticks() const noexcept -> std::uint64_t
+    {
+        return to_duration_.limit;
+    }
+
+    /// Get the longest duration that converts without overflow
+    ///
+    /// \return longest duration that converts without overflow
+    [[nodiscard]] auto max_duration() const noexcept -> Duration
+    {
+        return Duration{static_cast<rep>(to_ticks_.limit)};
+    }
+
+    /// Get the largest difference between a converted duration and the exact duration, for tick
+    /// counts up to \ref frequencypp::tick_converter::max_ticks
+    ///
+    /// \return bound on the error of \ref frequencypp::tick_converter::to_duration
+    [[nodiscard]] auto max_error() const noexcept -> Duration
+    {
+        return Duration{static_cast<rep>(to_duration_.error(ratio_))};
+    }
+
+    /// Get the largest difference between a converted tick count and the exact tick count, for
+    /// durations up to \ref frequencypp::tick_converter::max_duration
+    ///
+    /// \return bound on the error of \ref frequencypp::tick_converter::to_ticks
+    [[nodiscard]] auto max_tick_error() const noexcept -> std::uint64_t
+    {
+        return to_ticks_.error(1.0L / ratio_);
+    }
+};
+
+} // namespace frequencypp
+
+#endif // FREQUENCYPP_TICK_CONVERTER_HPP
@@ -0,0 +1,337 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/// \file
+/// Contains lazy views applying \ref frequencypp::frequency_cast to the elements of a range
+
+#ifndef FREQUENCYPP_VIEWS_HPP
+#define FREQUENCYPP_VIEWS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <frequencypp/detail/attributes.hpp>
+#include <frequencypp/frequency_core.hpp>
+
+namespace frequencypp {
+
+/// Iterator adaptor that converts the elements of \p Iterator with \ref frequencypp::frequency_cast
+/// as they are dereferenced
+///
+/// Dereferencing yields the converted frequency by value, so the elements cannot be modified
+/// through it.  A forward iterator must yield a reference, so the iterator reports itself as an
+/// input iterator to C++17 algorithms, as \c std::ranges::transform_view does.  It nonetheless
+/// provides the operations of \p Iterator, such as indexing when \p Iterator is random-access,
+/// and from C++20 reports them through \c iterator_concept.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Iterator iterator over frequencies or durations
+template<typename ToFrequency, typename Iterator>
+class cast_iterator
+{
+    static_assert(detail::is_frequency_v<ToFrequency>, "ToFrequency must be a frequency");
+
+    using traits = std::iterator_traits<Iterator>;
+
+    Iterator it_;
+
+public:
+    /// Category reported to C++17 algorithms, which is input as the elements are yielded by value
+    using iterator_category = std::input_iterator_tag;
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+    /// Concept modeled by the iterator, which is that of \p Iterator up to random-access
+    using iterator_concept = std::conditional_t<
+        std::is_base_of_v<std::random_access_iterator_tag, typename traits::iterator_category>,
+        std::random_access_iterator_tag,
+        typename traits::iterator_category>;
+#endif
+    /// Type of the converted elements
+    using value_type = ToFrequency;
+    /// Type of the distance between iterators
+    using difference_type = typename traits::difference_type;
+    /// The elements are converted on dereference, so there is no pointer to them
+    using pointer = void;
+    /// Type yielded by dereferencing, which is the converted value
+    using reference = ToFrequency;
+
+    /// Default-construct the iterator
+    cast_iterator() = default;
+
+    /// Construct an iterator converting the elements of \p it
+    ///
+    /// \param it iterator to adapt
+    FREQUENCYPP_INLINE constexpr explicit cast_iterator(Iterator it)
+        : it_(it)
+    {}
+
+    /// Get the adapted iterator
+    ///
+    /// \return adapted iterator
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto base() const -> const Iterator&
+    {
+        return it_;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator*() const -> reference
+    {
+        return frequency_cast<ToFrequency>(*it_);
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator[](difference_type n) const -> reference
+    {
+        return frequency_cast<ToFrequency>(it_[n]);
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator++() -> cast_iterator&
+    {
+        ++it_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator++(int) -> cast_iterator
+    {
+        return cast_iterator{it_++};
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator--() -> cast_iterator&
+    {
+        --it_;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator--(int) -> cast_iterator
+    {
+        return cast_iterator{it_--};
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator+=(difference_type n) -> cast_iterator&
+    {
+        it_ += n;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE constexpr auto operator-=(difference_type n) -> cast_iterator&
+    {
+        it_ -= n;
+        return *this;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator+(cast_iterator i, difference_type n)
+        -> cast_iterator
+    {
+        return i += n;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator+(difference_type n, cast_iterator i)
+        -> cast_iterator
+    {
+        return i += n;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator-(cast_iterator i, difference_type n)
+        -> cast_iterator
+    {
+        return i -= n;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator-(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> difference_type
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator==(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator!=(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ != rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator<(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ < rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator<=(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ <= rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator>(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ > rhs.it_;
+    }
+
+    FREQUENCYPP_INLINE friend constexpr auto operator>=(
+        const cast_iterator& lhs, const cast_iterator& rhs) -> bool
+    {
+        return lhs.it_ >= rhs.it_;
+    }
+};
+
+namespace detail {
+
+template<typename Iterator>
+FREQUENCYPP_INLINE constexpr auto base_distance(const Iterator& first, const Iterator& last)
+{
+    return std::distance(first, last);
+}
+
+// Nested cast iterators are measured by the iterators they adapt, which keep their category
+template<typename ToFrequency, typename Iterator>
+FREQUENCYPP_INLINE constexpr auto base_distance(const cast_iterator<ToFrequency, Iterator>& first,
+    const cast_iterator<ToFrequency, Iterator>& last)
+{
+    return base_distance(first.base(), last.base());
+}
+
+} // namespace detail
+
+/// View of the elements between two iterators converted with \ref frequencypp::frequency_cast
+///
+/// The view refers to the elements rather than owning them, so it is cheap to copy and must not
+/// outlive them.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Iterator iterator over frequencies or durations
+template<typename ToFrequency, typename Iterator>
+class cast_view
+{
+    Iterator first_;
+    Iterator last_;
+
+public:
+    /// Iterator over the converted elements
+    using iterator = cast_iterator<ToFrequency, Iterator>;
+    /// Type of the converted elements
+    using value_type = ToFrequency;
+    /// Type of the number of elements
+    using size_type = std::size_t;
+
+    /// Construct a view of the elements in [\p first, \p last)
+    ///
+    /// \param first iterator to the first element
+    /// \param last iterator past the last element
+    FREQUENCYPP_INLINE constexpr cast_view(Iterator first, Iterator last)
+        : first_(first)
+        , last_(last)
+    {}
+
+    /// Get an iterator to the first converted element
+    ///
+    /// \return iterator to the first converted element
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto begin() const -> iterator
+    {
+        return iterator{first_};
+    }
+
+    /// Get an iterator past the last converted element
+    ///
+    /// \return iterator past the last converted element
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto end() const -> iterator
+    {
+        return iterator{last_};
+    }
+
+    /// Determine whether the view has no elements
+    ///
+    /// \retval true if the view has no elements
+    /// \retval false if the view has elements
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto empty() const -> bool
+    {
+        return first_ == last_;
+    }
+
+    /// Get the number of elements in the view
+    ///
+    /// \return number of elements in the view
+    [[nodiscard]] FREQUENCYPP_INLINE constexpr auto size() const -> size_type
+    {
+        return static_cast<size_type>(detail::base_distance(first_, last_));
+    }
+
+    /// Get converted element \p i, which requires \p Iterator to be random-access
+    ///
+    /// \param i index of the element
+    /// \return converted element \p i
+    FREQUENCYPP_INLINE constexpr auto operator[](size_type i) const -> value_type
+    {
+        return begin()[static_cast<typename iterator::difference_type>(i)];
+    }
+};
+
+} // namespace frequencypp
+
+namespace frequencypp::detail {
+
+template<typename T>
+struct is_cast_view : std::false_type
+{};
+
+template<typename ToFrequency, typename Iterator>
+struct is_cast_view<cast_view<ToFrequency, Iterator>> : std::true_type
+{};
+
+// Views refer to their elements, so they can be adapted as temporaries, unlike containers
+template<typename Range>
+constexpr bool is_viewable_v = std::is_lvalue_reference_v<Range>
+    || is_cast_view<std::remove_cv_t<std::remove_reference_t<Range>>>::value;
+
+} // namespace frequencypp::detail
+
+namespace frequencypp::views {
+
+/// Make a view of the elements of \p range converted to \p ToFrequency as they are read
+///
+/// The view composes with itself, so a view may be cast again.  Containers must be passed as
+/// lvalues, as the view refers to their elements.
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Range range of frequencies or durations
+/// \param range range to view
+/// \return view of the converted elements of \p range
+template<typename ToFrequency, typename Range>
+FREQUENCYPP_INLINE constexpr auto cast(Range&& range)
+    -> std::enable_if_t<detail::is_viewable_v<Range>,
+        cast_view<ToFrequency, decltype(std::begin(range))>>
+{
+    return {std::begin(range), std::end(range)};
+}
+
+/// Make a view of the elements in [\p first, \p last) converted to \p ToFrequency as they are read
+///
+/// \tparam ToFrequency \ref frequencypp::frequency type to convert to
+/// \tparam Iterator iterator over frequencies or durations
+/// \param first iterator to the first element
+/// \param last iterator past the last element
+/// \return view of the converted elements in [\p first, \p last)
+template<typename ToFrequency, typename Iterator>
+FREQUENCYPP_INLINE constexpr auto cast(Iterator first, Iterator last)
+    -> cast_view<ToFrequency, Iterator>
+{
+    return {first, last};
+}
+
+} // namespace frequencypp::views
+
+#endif // FREQUENCYPP_VIEWS_HPP
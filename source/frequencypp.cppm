@@ -0,0 +1,83 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Module interface unit exporting the public names of frequency.hpp as the named module
+// frequencypp
+//
+// The header is included in the global module fragment, so that its specializations of std
+// templates and its detail namespaces are reachable without being exported, which they cannot
+// be. The public names are then exported by using-declarations.
+
+module;
+
+#include <frequencypp/frequency.hpp>
+
+export module frequencypp;
+
+export namespace frequencypp {
+
+#if FREQUENCYPP_HAS_INT128
+using frequencypp::int128_t;
+using frequencypp::uint128_t;
+#endif
+
+using frequencypp::frequency;
+using frequencypp::frequency_select;
+using frequencypp::frequency_values;
+
+using frequencypp::gigahertz;
+using frequencypp::hertz;
+using frequencypp::kilohertz;
+using frequencypp::megahertz;
+using frequencypp::microhertz;
+using frequencypp::millihertz;
+using frequencypp::nanohertz;
+using frequencypp::petahertz;
+using frequencypp::terahertz;
+
+using frequencypp::abs;
+using frequencypp::ceil;
+using frequencypp::duration_cast;
+using frequencypp::floor;
+using frequencypp::frequency_cast;
+using frequencypp::round;
+
+using frequencypp::operator+;
+using frequencypp::operator-;
+using frequencypp::operator*;
+using frequencypp::operator/;
+using frequencypp::operator%;
+using frequencypp::operator==;
+using frequencypp::operator!=;
+using frequencypp::operator<;
+using frequencypp::operator<=;
+using frequencypp::operator>;
+using frequencypp::operator>=;
+using frequencypp::operator<<;
+
+inline namespace literals {
+
+using frequencypp::literals::operator""_nHz;
+using frequencypp::literals::operator""_uHz;
+using frequencypp::literals::operator""_mHz;
+using frequencypp::literals::operator""_Hz;
+using frequencypp::literals::operator""_KHz;
+using frequencypp::literals::operator""_MHz;
+using frequencypp::literals::operator""_GHz;
+using frequencypp::literals::operator""_THz;
+using frequencypp::literals::operator""_PHz;
+
+} // namespace literals
+
+} // namespace frequencypp
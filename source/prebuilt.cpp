@@ -0,0 +1,43 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/prebuilt.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <ratio>
+
+namespace frequencypp {
+
+template struct frequency<std::int64_t, std::nano>;
+template struct frequency<std::int64_t, std::micro>;
+template struct frequency<std::int64_t, std::milli>;
+template struct frequency<std::int64_t, std::ratio<1>>;
+template struct frequency<std::int64_t, std::kilo>;
+template struct frequency<std::int64_t, std::mega>;
+template struct frequency<std::int32_t, std::giga>;
+template struct frequency<std::int32_t, std::tera>;
+template struct frequency<std::int16_t, std::peta>;
+
+template auto operator<<(std::ostream& os, const nanohertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const microhertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const millihertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const hertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const kilohertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const megahertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const gigahertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const terahertz& f) -> std::ostream&;
+template auto operator<<(std::ostream& os, const petahertz& f) -> std::ostream&;
+
+} // namespace frequencypp
@@ -0,0 +1,97 @@
+cmake_minimum_required(VERSION 3.14)
+
+macro(default name)
+    if(NOT DEFINED "${name}")
+        set("${name}" "${ARGN}")
+    endif()
+endmacro()
+
+default(COMPILER c++)
+default(FLAGS -std=c++17)
+default(OPTIMIZATION -O2)
+default(DEFINITIONS "")
+default(MODE instructions)
+default(SOURCE "${CMAKE_CURRENT_LIST_DIR}/codegen/zero_overhead.cpp")
+default(INCLUDE_DIRS "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+set(include_flags "")
+foreach(dir IN LISTS INCLUDE_DIRS)
+    list(APPEND include_flags -I "${dir}")
+endforeach()
+
+execute_process(
+    COMMAND "${COMPILER}" ${FLAGS} "${OPTIMIZATION}" ${DEFINITIONS} ${include_flags}
+        -fno-asynchronous-unwind-tables -S -o - "${SOURCE}"
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE assembly
+    ERROR_VARIABLE error
+)
+if(NOT result EQUAL "0")
+    message(FATAL_ERROR "'${SOURCE}': compiler returned with ${result}\n${error}")
+endif()
+
+# Collect the instructions of each function, which are the indented lines that are not directives,
+# from its label up to the next function label
+string(REPLACE ";" "\;" assembly "${assembly}")
+string(REPLACE "\n" ";" lines "${assembly}")
+set(functions "")
+set(current "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^_?((raw|frequency)_[A-Za-z0-9_]+):")
+        set(current "${CMAKE_MATCH_1}")
+        list(APPEND functions "${current}")
+        set("instructions_${current}" "")
+    elseif(line MATCHES "^[A-Za-z_]")
+        set(current "")
+    elseif(NOT current STREQUAL "" AND line MATCHES "^[ \t]+([a-z][^\t ]*)")
+        string(STRIP "${line}" instruction)
+        list(APPEND "instructions_${current}" "${instruction}")
+    endif()
+endforeach()
+
+set(failures "")
+set(pairs 0)
+foreach(function IN LISTS functions)
+    if(NOT function MATCHES "^frequency_(.*)$")
+        continue()
+    endif()
+    set(raw "raw_${CMAKE_MATCH_1}")
+    if(NOT DEFINED "instructions_${raw}")
+        list(APPEND failures "${function} has no matching ${raw}")
+        continue()
+    endif()
+    math(EXPR pairs "${pairs} + 1")
+
+    # In calls mode, which is meant for unoptimized builds with FREQUENCYPP_FORCE_INLINE defined,
+    # only check that every function of frequencypp was inlined
+    if(MODE STREQUAL "calls")
+        foreach(instruction IN LISTS "instructions_${function}")
+            if(instruction MATCHES "frequencypp")
+                list(APPEND failures "${function} does not inline: ${instruction}")
+            endif()
+        endforeach()
+        continue()
+    endif()
+
+    list(LENGTH "instructions_${function}" wrapped_count)
+    list(LENGTH "instructions_${raw}" raw_count)
+    if(wrapped_count GREATER raw_count)
+        list(JOIN "instructions_${function}" "\n    " wrapped_listing)
+        list(JOIN "instructions_${raw}" "\n    " raw_listing)
+        list(APPEND failures "${function} has ${wrapped_count} instructions where ${raw} has \
+${raw_count}:\n  ${function}:\n    ${wrapped_listing}\n  ${raw}:\n    ${raw_listing}")
+    endif()
+endforeach()
+
+if(pairs EQUAL "0")
+    message(FATAL_ERROR "No function pairs found in the assembly of '${SOURCE}'")
+endif()
+if(NOT failures STREQUAL "")
+    list(JOIN failures "\n\n" failure_list)
+    message(FATAL_ERROR "frequencypp adds overhead:\n\n${failure_list}\n")
+endif()
+if(MODE STREQUAL "calls")
+    message(STATUS "${pairs} functions inline all of frequencypp")
+else()
+    message(STATUS "${pairs} function pairs compile to the same number of instructions")
+endif()
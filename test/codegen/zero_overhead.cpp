@@ -0,0 +1,160 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Pairs of functions computing the same result, one on raw integers and one through frequencypp
+//
+// test/codegen.cmake compiles this file at -O2 and checks that each frequency_<name> function
+// compiles to no more instructions than the matching raw_<name> function.  It also compiles it at
+// -O0 with FREQUENCYPP_FORCE_INLINE defined and checks that no function of frequencypp is called.
+// The functions have C linkage, so that their symbols in the assembly are their plain names.
+
+#include <frequencypp/bounded.hpp>
+#include <frequencypp/expression.hpp>
+#include <frequencypp/frequency_core.hpp>
+#include <frequencypp/views.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+using frequencypp::hertz;
+using frequencypp::kilohertz;
+using frequencypp::megahertz;
+
+using bounded_megahertz =
+    frequencypp::frequency<frequencypp::bounded<std::int16_t, 0, 2000>, std::mega>;
+using kilohertz32 = frequencypp::frequency<std::int32_t, std::kilo>;
+
+extern "C" {
+
+auto raw_add(std::int64_t a, std::int64_t b) -> std::int64_t
+{
+    return a + b;
+}
+
+auto frequency_add(hertz a, hertz b) -> hertz
+{
+    return a + b;
+}
+
+auto raw_add_mixed(std::int64_t hz, std::int64_t khz) -> std::int64_t
+{
+    return hz + khz * 1000;
+}
+
+auto frequency_add_mixed(hertz hz, kilohertz khz) -> hertz
+{
+    return hz + khz;
+}
+
+auto raw_less(std::int64_t a, std::int64_t b) -> bool
+{
+    return a < b;
+}
+
+auto frequency_less(hertz a, hertz b) -> bool
+{
+    return a < b;
+}
+
+auto raw_less_mixed(std::int64_t hz, std::int64_t khz) -> bool
+{
+    return hz < khz * 1000;
+}
+
+auto frequency_less_mixed(hertz hz, kilohertz khz) -> bool
+{
+    return hz < khz;
+}
+
+auto raw_cast_up(std::int64_t khz) -> std::int64_t
+{
+    return khz * 1000;
+}
+
+auto frequency_cast_up(kilohertz khz) -> hertz
+{
+    return frequencypp::frequency_cast<hertz>(khz);
+}
+
+auto raw_cast_down(std::int64_t hz) -> std::int64_t
+{
+    return hz / 1000;
+}
+
+auto frequency_cast_down(hertz hz) -> kilohertz
+{
+    return frequencypp::frequency_cast<kilohertz>(hz);
+}
+
+auto raw_duration_multiply(std::int64_t ns, std::int64_t hz) -> std::int64_t
+{
+    return ns * hz / 1000000000;
+}
+
+auto frequency_duration_multiply(std::chrono::nanoseconds ns, hertz hz) -> std::int64_t
+{
+    return ns * hz;
+}
+
+auto raw_assign(std::int64_t* out, std::int64_t a) -> void
+{
+    *out = a;
+}
+
+auto frequency_assign(hertz* out, hertz a) -> void
+{
+    *out = a;
+}
+
+auto raw_sum_cast(const std::int64_t* khz, std::size_t n) -> std::int64_t
+{
+    auto sum = std::int64_t{0};
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += khz[i] * 1000;
+    }
+    return sum;
+}
+
+auto frequency_sum_cast(const kilohertz* khz, std::size_t n) -> hertz
+{
+    auto sum = hertz::zero();
+    for (const auto hz : frequencypp::views::cast<hertz>(khz, khz + n)) {
+        sum += hz;
+    }
+    return sum;
+}
+
+auto raw_bounded_cast(std::int16_t mhz) -> std::int32_t
+{
+    return std::int32_t{mhz} * 1000;
+}
+
+auto frequency_bounded_cast(bounded_megahertz mhz) -> kilohertz32
+{
+    return frequencypp::frequency_cast<kilohertz32>(mhz);
+}
+
+auto raw_add_chain(std::int64_t mhz, std::int64_t khz, std::int64_t hz, std::int64_t khz2)
+    -> std::int64_t
+{
+    return mhz * 1000000 + khz * 1000 - hz + khz2 * 1000;
+}
+
+auto frequency_add_chain(megahertz mhz, kilohertz khz, hertz hz, kilohertz khz2) -> hertz
+{
+    return frequencypp::expr::evaluate(frequencypp::expr::lazy(mhz) + khz - hz + khz2);
+}
+
+} // extern "C"
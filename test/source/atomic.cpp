@@ -0,0 +1,127 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/atomic.hpp>
+#include <frequencypp/saturating.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using sat_hertz = frequencypp::frequency<frequencypp::saturating<std::int32_t>>;
+
+} // namespace
+
+TEST_CASE("atomic frequencies are lock-free for integral representations", "[atomic]")
+{
+    using namespace ::frequencypp;
+
+    STATIC_REQUIRE(atomic_frequency<hertz>::is_always_lock_free);
+    STATIC_REQUIRE(atomic_frequency<petahertz>::is_always_lock_free);
+    REQUIRE(atomic_frequency<hertz>{}.is_lock_free());
+}
+
+TEST_CASE("atomic frequencies load and store", "[atomic]")
+{
+    using namespace ::frequencypp;
+
+    auto a = atomic_frequency<hertz>{};
+    REQUIRE(a.load() == hertz::zero());
+
+    a.store(hertz{440});
+    REQUIRE(a.load() == hertz{440});
+    REQUIRE(a.load(std::memory_order_relaxed) == hertz{440});
+
+    a = hertz{880};
+    REQUIRE(static_cast<hertz>(a) == hertz{880});
+
+    // Kilohertz converts implicitly to hertz
+    a.store(kilohertz{2});
+    REQUIRE(a.load() == hertz{2000});
+
+    REQUIRE(atomic_frequency<kilohertz>{kilohertz{3}}.load() == kilohertz{3});
+}
+
+TEST_CASE("atomic frequencies exchange", "[atomic]")
+{
+    using namespace ::frequencypp;
+
+    auto a = atomic_frequency<hertz>{hertz{1}};
+    REQUIRE(a.exchange(hertz{2}) == hertz{1});
+    REQUIRE(a.load() == hertz{2});
+
+    auto expected = hertz{3};
+    REQUIRE_FALSE(a.compare_exchange_strong(expected, hertz{4}));
+    REQUIRE(expected == hertz{2});
+    REQUIRE(a.compare_exchange_strong(expected, hertz{4}));
+    REQUIRE(a.load() == hertz{4});
+
+    expected = hertz{4};
+    while (!a.compare_exchange_weak(
+        expected, hertz{5}, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        REQUIRE(expected == hertz{4});
+    }
+    REQUIRE(a.load() == hertz{5});
+}
+
+TEST_CASE("atomic frequencies add and subtract", "[atomic]")
+{
+    using namespace ::frequencypp;
+
+    auto a = atomic_frequency<hertz>{hertz{100}};
+    REQUIRE(a.fetch_add(hertz{10}) == hertz{100});
+    REQUIRE(a.fetch_sub(hertz{20}) == hertz{110});
+    REQUIRE(a.load() == hertz{90});
+    REQUIRE((a += kilohertz{1}) == hertz{1090});
+    REQUIRE((a -= hertz{90}) == hertz{1000});
+
+    // Representations without atomic arithmetic are updated in a loop
+    constexpr auto max = std::numeric_limits<std::int32_t>::max();
+    auto s = atomic_frequency<sat_hertz>{sat_hertz{max - 1}};
+    REQUIRE(s.fetch_add(sat_hertz{5}).count().value() == max - 1);
+    REQUIRE(s.load().count().value() == max);
+    REQUIRE((s -= sat_hertz{7}).count().value() == max - 7);
+}
+
+TEST_CASE("atomic frequencies add without losing updates across threads", "[atomic]")
+{
+    using namespace ::frequencypp;
+
+    constexpr auto threads = 4;
+    constexpr auto iterations = 10000;
+
+    auto a = atomic_frequency<hertz>{};
+    auto s = atomic_frequency<sat_hertz>{};
+    auto workers = std::vector<std::thread>{};
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (auto i = 0; i < iterations; ++i) {
+                a.fetch_add(kilohertz{1}, std::memory_order_relaxed);
+                s += sat_hertz{1};
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    REQUIRE(a.load() == kilohertz{threads * iterations});
+    REQUIRE(s.load().count().value() == threads * iterations);
+}
@@ -0,0 +1,159 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/bounded.hpp>
+#include <frequencypp/checked.hpp>
+#include <frequencypp/frequency_io.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+
+using percent = frequencypp::bounded<std::int64_t, 0, 100>;
+using signed_byte = frequencypp::bounded<std::int64_t, -128, 127>;
+using radio_megahertz = frequencypp::frequency<frequencypp::bounded<std::int64_t, 0, 2000>,
+    std::mega>;
+using radio_kilohertz = frequencypp::frequency<frequencypp::bounded<std::int64_t, 0, 2000000>,
+    std::kilo>;
+
+} // namespace
+
+TEST_CASE("bounded values keep their bounds", "[bounded]")
+{
+    STATIC_REQUIRE(percent::lower == 0);
+    STATIC_REQUIRE(percent::upper == 100);
+    STATIC_REQUIRE(percent{42}.value() == 42);
+    STATIC_REQUIRE(std::numeric_limits<percent>::max().value() == 100);
+    STATIC_REQUIRE(std::numeric_limits<signed_byte>::lowest().value() == -128);
+
+    // Widening to a range that includes the original is implicit, narrowing is not
+    STATIC_REQUIRE(std::is_convertible_v<percent, frequencypp::bounded<std::int32_t, -5, 200>>);
+    STATIC_REQUIRE_FALSE(std::is_convertible_v<signed_byte, percent>);
+}
+
+TEST_CASE("bounded arithmetic propagates bounds", "[bounded]")
+{
+    using sum = decltype(percent{} + percent{});
+    STATIC_REQUIRE(sum::lower == 0);
+    STATIC_REQUIRE(sum::upper == 200);
+
+    using difference = decltype(percent{} - signed_byte{});
+    STATIC_REQUIRE(difference::lower == -127);
+    STATIC_REQUIRE(difference::upper == 228);
+
+    using product = decltype(signed_byte{} * signed_byte{});
+    STATIC_REQUIRE(product::lower == -16256);
+    STATIC_REQUIRE(product::upper == 16384);
+
+    using divisor = frequencypp::bounded<std::int64_t, 2, 10>;
+    using quotient = decltype(signed_byte{} / divisor{});
+    STATIC_REQUIRE(quotient::lower == -64);
+    STATIC_REQUIRE(quotient::upper == 63);
+
+    using remainder = decltype(signed_byte{} % divisor{});
+    STATIC_REQUIRE(remainder::lower == -9);
+    STATIC_REQUIRE(remainder::upper == 9);
+
+    using negation = decltype(-percent{});
+    STATIC_REQUIRE(negation::lower == -100);
+    STATIC_REQUIRE(negation::upper == 0);
+
+    STATIC_REQUIRE((percent{70} + percent{80}).value() == 150);
+    STATIC_REQUIRE((percent{7} - signed_byte{-100}).value() == 107);
+    STATIC_REQUIRE((signed_byte{-128} * signed_byte{127}).value() == -16256);
+    STATIC_REQUIRE((signed_byte{-77} / divisor{10}).value() == -7);
+    STATIC_REQUIRE((signed_byte{-77} % divisor{10}).value() == -7);
+}
+
+TEST_CASE("bounded results keep the operand storage unless it must widen", "[bounded]")
+{
+    using small = frequencypp::bounded<std::int8_t, -100, 100>;
+    STATIC_REQUIRE(std::is_same_v<decltype(small{} + small{})::value_type, std::int16_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(percent{} + percent{})::value_type, std::int64_t>);
+}
+
+TEST_CASE("bounded comparisons of disjoint ranges are constant", "[bounded]")
+{
+    using low = frequencypp::bounded<std::int64_t, 0, 9>;
+    using high = frequencypp::bounded<std::int64_t, 10, 20>;
+    auto l = low{3};
+    auto h = high{15};
+    REQUIRE(l < h);
+    REQUIRE(l != h);
+    REQUIRE_FALSE(l == h);
+    REQUIRE(h >= l);
+    REQUIRE(percent{5} == signed_byte{5});
+    REQUIRE(percent{5} <= signed_byte{6});
+}
+
+TEST_CASE("bounded frequencies convert through narrow intermediates", "[bounded]")
+{
+    using kilohertz32 = frequencypp::frequency<std::int32_t, std::kilo>;
+    constexpr auto f = radio_megahertz{1500};
+    STATIC_REQUIRE(frequencypp::frequency_cast<kilohertz32>(f).count() == 1500000);
+
+    // The bounds of the result follow from the bounds of the source
+    constexpr auto k = frequencypp::frequency_cast<radio_kilohertz>(f);
+    STATIC_REQUIRE(k.count().value() == 1500000);
+    STATIC_REQUIRE(std::is_same_v<decltype(k), const radio_kilohertz>);
+
+    // Conversions to wide enough checked representations cannot overflow
+    using chk_kilohertz = frequencypp::frequency<frequencypp::checked<std::int32_t>, std::kilo>;
+    const auto c = frequencypp::frequency_cast<chk_kilohertz>(f);
+    REQUIRE_FALSE(c.count().overflowed());
+    REQUIRE(c.count().value() == 1500000);
+
+    using double_gigahertz = frequencypp::frequency<double, std::giga>;
+    REQUIRE(frequencypp::frequency_cast<double_gigahertz>(f).count() == Approx(1.5));
+}
+
+TEST_CASE("bounded frequency arithmetic propagates bounds", "[bounded]")
+{
+    constexpr auto sum = radio_megahertz{3} + radio_kilohertz{500};
+    using sum_rep = std::decay_t<decltype(sum)>::rep;
+    STATIC_REQUIRE(std::is_same_v<std::decay_t<decltype(sum)>::period, std::kilo>);
+    STATIC_REQUIRE(sum_rep::lower == 0);
+    STATIC_REQUIRE(sum_rep::upper == 4000000);
+    STATIC_REQUIRE(sum.count().value() == 3500);
+
+    using common = std::common_type_t<radio_megahertz, radio_kilohertz>;
+    STATIC_REQUIRE(common::rep::upper == 2000000);
+    STATIC_REQUIRE(radio_megahertz{2} == radio_kilohertz{2000});
+    STATIC_REQUIRE(radio_megahertz{2} > radio_kilohertz{1999});
+
+    using gain = frequencypp::bounded<std::int64_t, 1, 4>;
+    constexpr auto scaled = radio_megahertz{100} * gain{3};
+    STATIC_REQUIRE(decltype(scaled)::rep::upper == 8000);
+    STATIC_REQUIRE(scaled.count().value() == 300);
+    STATIC_REQUIRE((gain{2} * radio_megahertz{100}).count().value() == 200);
+    STATIC_REQUIRE((radio_megahertz{100} / gain{4}).count().value() == 25);
+}
+
+TEST_CASE("bounded values mix with unbounded integers", "[bounded]")
+{
+    STATIC_REQUIRE(std::is_same_v<std::common_type_t<percent, int>, std::int64_t>);
+    STATIC_REQUIRE(std::is_same_v<std::common_type_t<short, signed_byte>, std::int64_t>);
+}
+
+TEST_CASE("bounded values are inserted as integers", "[bounded]")
+{
+    auto os = std::ostringstream{};
+    os << frequencypp::bounded<std::int8_t, 0, 100>{65};
+    REQUIRE(os.str() == "65");
+}
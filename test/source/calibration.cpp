@@ -0,0 +1,157 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/calibration.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+// Simulated time, advanced by every clock reading as a real clock read takes time
+struct fake_clock
+{
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<fake_clock>;
+    static constexpr bool is_steady = true;
+
+    static inline std::int64_t ns = 0;
+    static inline std::int64_t step = 20;
+    static inline int calls = 0;
+
+    static auto now() noexcept -> time_point
+    {
+        ++calls;
+        // Every seventh reading is delayed, as if preempted
+        ns += calls % 7 == 0 ? step * 50 : step;
+        return time_point{duration{ns}};
+    }
+};
+
+// Counter ticking at 2.4 GHz relative to the simulated time
+struct fake_counter
+{
+    static auto read() noexcept -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(fake_clock::ns) * 12 / 5;
+    }
+};
+
+// Clock that never advances, as a stalled clock or one too coarse to tick between samples
+struct stalled_clock
+{
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<stalled_clock>;
+    static constexpr bool is_steady = true;
+
+    static auto now() noexcept -> time_point
+    {
+        return time_point{duration{1'000}};
+    }
+};
+
+} // namespace
+
+TEST_CASE("calibration measures the counter frequency", "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    fake_clock::ns = 0;
+    const auto f = calibrate_frequency<fake_counter, fake_clock>();
+    REQUIRE(std::abs((f - 2'400_MHz).count()) <= 2'400'000'000 / 10'000);
+}
+
+TEST_CASE("calibration stops once the error bound is met", "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    auto options = calibration_options{};
+    options.tolerance = 1e-3;
+    options.min_duration = std::chrono::nanoseconds{0};
+    fake_clock::ns = 0;
+    static_cast<void>(calibrate_frequency<fake_counter, fake_clock>(options));
+    const auto quick = fake_clock::ns;
+
+    options.tolerance = 1e-5;
+    fake_clock::ns = 0;
+    static_cast<void>(calibrate_frequency<fake_counter, fake_clock>(options));
+    const auto precise = fake_clock::ns;
+
+    REQUIRE(quick < precise);
+    REQUIRE(quick < 1'000'000);
+}
+
+TEST_CASE("calibration gives up at the maximum duration", "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    auto options = calibration_options{};
+    options.tolerance = 0.0;
+    options.max_duration = std::chrono::microseconds{100};
+    fake_clock::ns = 0;
+    const auto f = calibrate_frequency<fake_counter, fake_clock>(options);
+    REQUIRE(fake_clock::ns < 200'000);
+    REQUIRE(std::abs((f - 2'400_MHz).count()) <= 2'400'000'000 / 100);
+}
+
+TEST_CASE("calibration against a stalled clock gives up at the maximum duration",
+    "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    auto options = calibration_options{};
+    options.max_duration = std::chrono::milliseconds{5};
+    const auto begin = std::chrono::steady_clock::now();
+    const auto f = calibrate_frequency<fake_counter, stalled_clock>(options);
+    REQUIRE(std::chrono::steady_clock::now() - begin >= options.max_duration);
+    REQUIRE(f == 0_Hz);
+}
+
+TEST_CASE("kernel-exported frequencies are parsed", "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    const auto* path = "frequencypp_test_tsc_freq_khz";
+    {
+        auto file = std::ofstream{path};
+        file << "2893412\n";
+    }
+    REQUIRE(tsc_frequency_from_file(path) == 2'893'412_KHz);
+    {
+        auto file = std::ofstream{path};
+        file << "garbage\n";
+    }
+    REQUIRE_FALSE(tsc_frequency_from_file(path).has_value());
+    static_cast<void>(std::remove(path));
+    REQUIRE_FALSE(tsc_frequency_from_file("/nonexistent/tsc_freq_khz").has_value());
+}
+
+#if FREQUENCYPP_HAS_TSC
+TEST_CASE("time-stamp counter frequency is cached", "[calibration]")
+{
+    using namespace ::frequencypp;
+
+    const auto f = tsc_frequency();
+    REQUIRE(f > 0_Hz);
+    REQUIRE(tsc_frequency() == f);
+}
+#endif
@@ -0,0 +1,166 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/checked.hpp>
+#include <frequencypp/frequency_io.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+using chk16 = frequencypp::checked<std::int16_t>;
+using chk_hertz = frequencypp::frequency<frequencypp::checked<std::int64_t>>;
+using chk_kilohertz = frequencypp::frequency<frequencypp::checked<std::int16_t>, std::kilo>;
+
+constexpr auto max16 = std::numeric_limits<std::int16_t>::max();
+constexpr auto min16 = std::numeric_limits<std::int16_t>::min();
+
+} // namespace
+
+TEST_CASE("checked values flag unrepresentable construction", "[checked]")
+{
+    REQUIRE_FALSE(chk16{1234}.overflowed());
+    REQUIRE(chk16{100000}.overflowed());
+    REQUIRE(frequencypp::checked<std::uint8_t>{-1}.overflowed());
+    REQUIRE(chk16{frequencypp::checked<std::int64_t>{1 << 20}}.overflowed());
+    REQUIRE_FALSE(chk16{frequencypp::checked<std::int64_t>{-7}}.overflowed());
+}
+
+TEST_CASE("checked arithmetic flags overflow", "[checked]")
+{
+    REQUIRE((chk16{max16} + chk16{1}).overflowed());
+    REQUIRE((chk16{min16} - chk16{1}).overflowed());
+    REQUIRE((chk16{20000} * chk16{2}).overflowed());
+    REQUIRE((chk16{min16} / chk16{-1}).overflowed());
+    REQUIRE((chk16{min16} % chk16{-1}).overflowed());
+    REQUIRE((chk16{5} / chk16{0}).overflowed());
+    REQUIRE((-chk16{min16}).overflowed());
+
+    auto c = chk16{max16};
+    REQUIRE((++c).overflowed());
+    auto d = chk16{min16};
+    REQUIRE((d--).overflowed() == false);
+    REQUIRE(d.overflowed());
+
+    auto e = chk16{100} + chk16{23};
+    REQUIRE_FALSE(e.overflowed());
+    REQUIRE(e.value() == 123);
+}
+
+TEST_CASE("checked overflow flags are sticky", "[checked]")
+{
+    auto c = chk16{max16} + chk16{1};
+    c -= chk16{1};
+    REQUIRE(c.value() == max16);
+    REQUIRE(c.overflowed());
+    REQUIRE((chk16{1} + c).overflowed());
+    REQUIRE((c * chk16{0}).overflowed());
+}
+
+TEST_CASE("checked arithmetic is usable in constant expressions", "[checked]")
+{
+    constexpr auto c = chk16{max16} + chk16{1};
+    STATIC_REQUIRE(c.overflowed());
+    constexpr auto f = chk_hertz{40} + chk_hertz{2};
+    STATIC_REQUIRE(f.count().value() == 42);
+    STATIC_REQUIRE_FALSE(f.count().overflowed());
+}
+
+TEST_CASE("checked frequencies flag overflow in frequency arithmetic", "[checked]")
+{
+    using namespace ::frequencypp;
+
+    auto f1 = chk_kilohertz::max();
+    ++f1;
+    REQUIRE(f1.count().overflowed());
+
+    auto f2 = chk_kilohertz{30000} + chk_kilohertz{30000};
+    REQUIRE(std::is_same_v<decltype(f2), chk_kilohertz>);
+    REQUIRE(f2.count().overflowed());
+
+    auto f3 = chk_kilohertz{30000} * 4;
+    REQUIRE(std::is_same_v<decltype(f3)::rep, checked<int>>);
+    REQUIRE_FALSE(f3.count().overflowed());
+    REQUIRE(f3.count().value() == 120000);
+
+    auto f4 = chk_kilohertz{1} + 1_Hz;
+    REQUIRE(std::is_same_v<decltype(f4)::rep, checked<std::int64_t>>);
+    REQUIRE_FALSE(f4.count().overflowed());
+    REQUIRE(f4 == 1001_Hz);
+}
+
+TEST_CASE("checked frequencies propagate overflow through casts", "[checked]")
+{
+    using namespace ::frequencypp;
+    using chk_petahertz = frequency<checked<std::int16_t>, std::peta>;
+
+    auto exact = frequency_cast<chk_kilohertz>(chk_hertz{12'345'678});
+    REQUIRE_FALSE(exact.count().overflowed());
+    REQUIRE(exact.count().value() == 12345);
+
+    // Narrowing to the destination representation
+    REQUIRE(frequency_cast<chk_kilohertz>(chk_hertz{1'000'000'000}).count().overflowed());
+
+    // Multiplication by the period ratio
+    REQUIRE(frequency_cast<chk_hertz>(chk_petahertz{max16}).count().overflowed());
+
+    // An already flagged source stays flagged
+    auto flagged = chk_hertz::max() + chk_hertz{1};
+    REQUIRE(frequency_cast<chk_kilohertz>(flagged).count().overflowed());
+
+    // A count that wrapped to zero converts to zero and stays flagged
+    using chk_milliseconds = std::chrono::duration<checked<std::int64_t>, std::milli>;
+    auto wrapped = chk_hertz::min() + chk_hertz::min();
+    REQUIRE(wrapped.count().value() == 0);
+    auto period = duration_cast<chk_milliseconds>(wrapped);
+    REQUIRE(period.count().value() == 0);
+    REQUIRE(period.count().overflowed());
+    auto rate = frequency_cast<chk_hertz>(chk_milliseconds::min() + chk_milliseconds::min());
+    REQUIRE(rate.count().value() == 0);
+    REQUIRE(rate.count().overflowed());
+}
+
+TEST_CASE("checked frequency batches are validated at once", "[checked]")
+{
+    using namespace ::frequencypp;
+
+    auto fs = std::array<chk_kilohertz, 4>{
+        chk_kilohertz{1}, chk_kilohertz{2}, chk_kilohertz{3}, chk_kilohertz{4}};
+    for (auto& f : fs) {
+        f *= 1000;
+    }
+    REQUIRE_FALSE(any_overflow(fs.data(), fs.size()));
+    for (auto& f : fs) {
+        f *= 10;
+    }
+    REQUIRE(any_overflow(fs.data(), fs.size()));
+    REQUIRE_FALSE(any_overflow(fs.data(), 3));
+}
+
+TEST_CASE("checked frequencies print their overflow state", "[checked]")
+{
+    auto s1 = std::ostringstream{};
+    s1 << chk_kilohertz{12};
+    REQUIRE(s1.str() == "12KHz");
+
+    auto s2 = std::ostringstream{};
+    s2 << chk_kilohertz::max() + chk_kilohertz{1};
+    REQUIRE(s2.str() == "-32768(overflow)KHz");
+}
@@ -0,0 +1,133 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/compression.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Deterministic jitter in [-3, 3], as seen on a stable oscillator sampled once per millisecond
+auto jitter(std::size_t i) -> std::int64_t
+{
+    return static_cast<std::int64_t>((i * 2654435761U) % 7) - 3;
+}
+
+template<typename Frequency, std::size_t BlockSize>
+auto round_trip(const std::vector<Frequency>& in) -> std::vector<Frequency>
+{
+    auto e = frequencypp::frequency_encoder<Frequency, BlockSize>{};
+    for (const auto& f : in) {
+        e.append(f);
+    }
+    e.flush();
+    REQUIRE(e.size() == in.size());
+
+    auto out = std::vector<Frequency>(in.size());
+    auto d = frequencypp::frequency_decoder<Frequency>{e};
+    REQUIRE(d.decode(out.data()) == in.size());
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("integral frequency series round-trip", "[compression]")
+{
+    using namespace ::frequencypp;
+
+    auto in = std::vector<hertz>{};
+    for (std::size_t i = 0; i < 1000; ++i) {
+        in.push_back(10_MHz + hertz{jitter(i)});
+    }
+    REQUIRE(round_trip<hertz, 64>(in) == in);
+    REQUIRE(round_trip<hertz, 256>(in) == in);
+
+    // Extremes wrap through the deltas without losing information
+    auto extremes = std::vector<frequency<std::int32_t>>{frequency<std::int32_t>::max(),
+        frequency<std::int32_t>::min(),
+        frequency<std::int32_t>{0},
+        frequency<std::int32_t>::max(),
+        frequency<std::int32_t>{-1}};
+    REQUIRE(round_trip<frequency<std::int32_t>, 4>(extremes) == extremes);
+
+    auto one = std::vector<petahertz>{petahertz{-7}};
+    REQUIRE(round_trip<petahertz, 16>(one) == one);
+}
+
+TEST_CASE("floating-point frequency series round-trip", "[compression]")
+{
+    using namespace ::frequencypp;
+    using fhertz = frequency<double>;
+    using ffhertz = frequency<float, std::kilo>;
+
+    auto in = std::vector<fhertz>{};
+    auto fin = std::vector<ffhertz>{};
+    for (std::size_t i = 0; i < 700; ++i) {
+        in.push_back(fhertz{32768.0 + 0.125 * static_cast<double>(jitter(i))});
+        fin.push_back(ffhertz{2400.5F + static_cast<float>(i % 3)});
+    }
+    in.push_back(fhertz{std::numeric_limits<double>::infinity()});
+    in.push_back(fhertz{-0.0});
+    REQUIRE(round_trip<fhertz, 128>(in) == in);
+    REQUIRE(round_trip<ffhertz, 100>(fin) == fin);
+}
+
+TEST_CASE("slowly changing series compress by more than an order of magnitude", "[compression]")
+{
+    using namespace ::frequencypp;
+
+    auto e = frequency_encoder<hertz>{};
+    for (std::size_t i = 0; i < 60'000; ++i) {
+        e.append(19'200'000_Hz + hertz{jitter(i)});
+    }
+    e.flush();
+    const auto raw = e.size() * sizeof(hertz);
+    const auto encoded = e.words().size() * sizeof(std::uint64_t);
+    REQUIRE(raw / encoded >= 10);
+
+    auto f = frequency_encoder<frequency<double>>{};
+    for (std::size_t i = 0; i < 60'000; ++i) {
+        f.append(frequency<double>{50.0 + (i % 1000 == 0 ? 0.5 : 0.0)});
+    }
+    f.flush();
+    REQUIRE(f.size() * sizeof(double) / (f.words().size() * sizeof(std::uint64_t)) >= 10);
+}
+
+TEST_CASE("blocks are decoded independently", "[compression]")
+{
+    using namespace ::frequencypp;
+
+    auto e = frequency_encoder<kilohertz, 32>{};
+    for (std::int64_t i = 0; i < 100; ++i) {
+        e.append(kilohertz{i * i});
+    }
+    REQUIRE(e.block_offsets().size() == 3);
+    e.flush();
+
+    auto d = frequency_decoder<kilohertz>{e};
+    REQUIRE(d.block_count() == 4);
+    REQUIRE(d.block_size(0) == 32);
+    REQUIRE(d.block_size(3) == 4);
+
+    auto block = std::vector<kilohertz>(32);
+    REQUIRE(d.decode_block(2, block.data()) == 32);
+    REQUIRE(block.front() == kilohertz{64 * 64});
+    REQUIRE(block.back() == kilohertz{95 * 95});
+    REQUIRE(d.decode_block(3, block.data()) == 4);
+    REQUIRE(block[3] == kilohertz{99 * 99});
+}
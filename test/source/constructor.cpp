@@ -50,6 +50,20 @@ TEST_CASE("copy assign copies count", "[constructor]")
     REQUIRE(f2_copy.count() == f2.count());
 }
 
+TEST_CASE("copy assign is usable in constant expressions", "[constructor]")
+{
+    using namespace ::frequencypp;
+
+    constexpr auto assigned = [] {
+        auto f = frequency<int>{};
+        const auto g = frequency<int>{32};
+        f = g;
+        f = frequency<int>{f.count() + 1};
+        return f;
+    }();
+    STATIC_REQUIRE(assigned.count() == 33);
+}
+
 TEST_CASE("tick construct stores count", "[constructor]")
 {
     using namespace ::frequencypp;
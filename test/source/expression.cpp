@@ -0,0 +1,77 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/expression.hpp>
+#include <frequencypp/frequency.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+using namespace frequencypp::literals;
+
+TEST_CASE("expressions evaluate to the common type of their operands", "[expression]")
+{
+    constexpr auto e = frequencypp::expr::lazy(3_MHz) + 250_KHz - 7_Hz + 1_KHz;
+    using result = std::decay_t<decltype(e)>::result_type;
+    STATIC_REQUIRE(std::is_same_v<result, frequencypp::hertz>);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(e) == 3250993_Hz);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(e) == 3_MHz + 250_KHz - 7_Hz + 1_KHz);
+
+    const frequencypp::hertz h = e;
+    REQUIRE(h == 3250993_Hz);
+}
+
+TEST_CASE("expressions combine frequencies on either side", "[expression]")
+{
+    using frequencypp::expr::lazy;
+    constexpr auto a = 10_KHz - lazy(1_Hz);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(a) == 9999_Hz);
+    constexpr auto b = lazy(2_MHz) - (lazy(1_MHz) + 1_KHz);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(b) == 999_KHz);
+    constexpr auto c = -lazy(5_KHz) + 1_Hz;
+    STATIC_REQUIRE(frequencypp::expr::evaluate(c) == -4999_Hz);
+}
+
+TEST_CASE("expressions scale like the binary operators", "[expression]")
+{
+    using frequencypp::expr::lazy;
+    STATIC_REQUIRE(frequencypp::expr::evaluate(lazy(3_KHz) * 2 + 1_Hz) == 6001_Hz);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(2 * (lazy(1_KHz) + 1_Hz)) == 2002_Hz);
+
+    // Integral quotients truncate in the period of their operand, as with the binary operators
+    STATIC_REQUIRE(frequencypp::expr::evaluate(lazy(3_KHz) / 2 + 1_Hz) == 1001_Hz);
+    STATIC_REQUIRE(frequencypp::expr::evaluate(lazy(3_KHz) / 2 + 1_Hz) == 3_KHz / 2 + 1_Hz);
+
+    const auto d = frequencypp::expr::evaluate(lazy(3_KHz) * 0.5 + 1_Hz);
+    STATIC_REQUIRE(std::is_same_v<decltype(d)::rep, double>);
+    REQUIRE(d.count() == Approx(1501.0));
+}
+
+TEST_CASE("expressions evaluate over arrays", "[expression]")
+{
+    const auto carriers = std::array<frequencypp::megahertz, 3>{100_MHz, 200_MHz, 300_MHz};
+    const auto offsets = std::array<frequencypp::kilohertz, 3>{1_KHz, -2_KHz, 3_KHz};
+    auto out = std::array<frequencypp::hertz, 3>{};
+
+    const auto e = frequencypp::expr::each(carriers.data())
+        + frequencypp::expr::each(offsets.data()) * 2 - 5_Hz;
+    frequencypp::expr::evaluate(e, out.data(), out.size());
+    REQUIRE(out[0] == 100001995_Hz);
+    REQUIRE(out[1] == 199995995_Hz);
+    REQUIRE(out[2] == 300005995_Hz);
+    REQUIRE(e[1] == out[1]);
+}
@@ -0,0 +1,129 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/fft.hpp>
+#include <frequencypp/frequency.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <ratio>
+#include <type_traits>
+#include <vector>
+
+using namespace frequencypp::literals;
+
+namespace {
+
+constexpr auto pi = 3.14159265358979323846;
+
+// Direct evaluation of the discrete Fourier transform, to check the fast transform against
+auto naive_dft(const std::vector<double>& x, std::size_t k) -> std::complex<double>
+{
+    auto sum = std::complex<long double>{};
+    const auto n = x.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto angle = -2 * static_cast<long double>(pi) * static_cast<long double>(k * i % n)
+            / static_cast<long double>(n);
+        sum += static_cast<long double>(x[i]) * std::polar(1.0L, angle);
+    }
+    return {static_cast<double>(sum.real()), static_cast<double>(sum.imag())};
+}
+
+template<std::size_t N>
+void check_against_dft()
+{
+    auto x = std::vector<double>(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        // Deterministic samples with components at many frequencies
+        x[i] = std::sin(0.37 * static_cast<double>(i * i)) + 0.25 * static_cast<double>(i % 3);
+    }
+    const auto plan = frequencypp::make_fft_plan<N>(1_KHz);
+    const auto s = plan(x.data());
+    REQUIRE(s.size() == N / 2 + 1);
+    for (std::size_t k = 0; k < s.size(); ++k) {
+        const auto expected = naive_dft(x, k);
+        REQUIRE(s[k].real() == Approx(expected.real()).margin(1e-9 * N));
+        REQUIRE(s[k].imag() == Approx(expected.imag()).margin(1e-9 * N));
+    }
+}
+
+} // namespace
+
+TEST_CASE("fft matches the discrete Fourier transform", "[fft]")
+{
+    check_against_dft<2>();
+    check_against_dft<4>();
+    check_against_dft<8>();
+    check_against_dft<16>();
+    check_against_dft<32>();
+    check_against_dft<128>();
+    check_against_dft<1024>();
+}
+
+TEST_CASE("fft bins are tagged with exact frequencies", "[fft]")
+{
+    const auto plan = frequencypp::make_fft_plan<1024>(48_KHz);
+    using bin = decltype(plan)::bin_frequency_type;
+    STATIC_REQUIRE(std::is_same_v<bin::period, std::ratio<125, 128>>);
+
+    // 48kHz / 1024 = 46.875Hz, which is exact in the bin period
+    REQUIRE(plan.resolution() == frequencypp::frequency<double>{46.875});
+    REQUIRE(plan.resolution() * 1024 == 48_KHz);
+
+    auto x = std::vector<double>(1024);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::cos(2 * pi * 5 * static_cast<double>(i) / 1024);
+    }
+    const auto s = plan(x.data());
+    REQUIRE(s.magnitude(5) == Approx(512.0));
+    REQUIRE(s.magnitude(4) == Approx(0.0).margin(1e-9));
+    REQUIRE(s.bin_frequency(5) == frequencypp::frequency<double>{234.375});
+    REQUIRE(s.bin_frequency(512) == 24_KHz);
+    REQUIRE(s.bin_frequency(1) == s.resolution());
+}
+
+TEST_CASE("fft maps frequencies to their nearest bins", "[fft]")
+{
+    const auto plan = frequencypp::make_fft_plan<1024>(48_KHz);
+    const auto s = plan(std::vector<double>(1024).data());
+    REQUIRE(s.nearest_bin(234_Hz) == 5);
+    REQUIRE(s.nearest_bin(24_KHz) == 512);
+    REQUIRE(s.nearest_bin(1_MHz) == 512);
+    REQUIRE(s.nearest_bin(-5_Hz) == 0);
+    // Halfway between bins 0 and 1 rounds up, and just below it rounds down
+    REQUIRE(s.nearest_bin(frequencypp::frequency<std::int64_t, std::milli>{23438}) == 1);
+    REQUIRE(s.nearest_bin(frequencypp::frequency<std::int64_t, std::milli>{23437}) == 0);
+    REQUIRE(s.nearest_bin(frequencypp::frequency<double>{23.4375}) == 1);
+    for (std::size_t k = 0; k < s.size(); ++k) {
+        REQUIRE(s.nearest_bin(s.bin_frequency(k)) == k);
+    }
+}
+
+TEST_CASE("fft transforms float samples into a reused spectrum", "[fft]")
+{
+    const auto plan = frequencypp::make_fft_plan<64, float>(8_KHz);
+    auto x = std::vector<float>(64);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<float>(std::sin(2 * pi * 8 * static_cast<double>(i) / 64));
+    }
+    auto s = decltype(plan)::spectrum_type{};
+    plan.transform(x.data(), s);
+    REQUIRE(s.magnitude(8) == Approx(32.0f).epsilon(1e-4));
+    REQUIRE(s.bin_frequency(8) == 1_KHz);
+    plan.transform(x.data(), s);
+    REQUIRE(s.size() == 33);
+}
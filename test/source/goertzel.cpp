@@ -0,0 +1,125 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/frequency.hpp>
+#include <frequencypp/goertzel.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+using namespace frequencypp::literals;
+
+namespace {
+
+constexpr auto pi = 3.14159265358979323846;
+
+// Row and column tones of DTMF signalling, plus a pilot tone so that the bank fills more than one
+// tile of vectors
+const auto tones = std::array<frequencypp::hertz, 9>{
+    697_Hz, 770_Hz, 852_Hz, 941_Hz, 1209_Hz, 1336_Hz, 1477_Hz, 1633_Hz, 2600_Hz};
+
+auto tone_pair(std::size_t n, double f1, double f2) -> std::vector<double>
+{
+    auto x = std::vector<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto t = static_cast<double>(i) / 8000;
+        x[i] = std::sin(2 * pi * f1 * t) + std::sin(2 * pi * f2 * t + 1);
+    }
+    return x;
+}
+
+} // namespace
+
+TEST_CASE("Coefficients depend only on the ratio of target and sample rate", "[goertzel]")
+{
+    const auto targets = std::array<frequencypp::frequency<double, std::kilo>, 3>{
+        frequencypp::frequency<double, std::kilo>{1.5}, 9500_Hz, 1_Hz};
+    const auto bank = frequencypp::goertzel_bank<>{targets.data(), targets.size(), 8_KHz, 100};
+    REQUIRE(bank.size() == 3);
+    REQUIRE(bank.block_size() == 100);
+    REQUIRE(bank.coefficient(0) == Approx(2 * std::cos(2 * pi * 1500 / 8000)));
+    // A target beyond the sample rate aliases to the same filter as its image below it
+    REQUIRE(bank.coefficient(1) == bank.coefficient(0));
+
+    const auto exact = std::array<frequencypp::millihertz, 1>{1000_mHz};
+    const auto precise =
+        frequencypp::goertzel_bank<>{exact.data(), exact.size(), 48000000000_mHz, 100};
+    REQUIRE(precise.coefficient(0) == Approx(2 * std::cos(2 * pi / 48000000)));
+}
+
+TEST_CASE("Powers match the discrete Fourier transform at the targets", "[goertzel]")
+{
+    constexpr auto n = std::size_t{205};
+    const auto x = tone_pair(n, 770, 1336);
+    auto bank = frequencypp::goertzel_bank<>{tones.data(), tones.size(), 8_KHz, n};
+    REQUIRE(bank.power(0) == 0);
+    REQUIRE(bank.process(x.data(), x.size()) == 1);
+
+    for (std::size_t t = 0; t < tones.size(); ++t) {
+        auto sum = std::complex<double>{};
+        const auto w = 2 * pi * static_cast<double>(tones[t].count()) / 8000;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += x[i] * std::polar(1.0, -w * static_cast<double>(i));
+        }
+        REQUIRE(bank.power(t) == Approx(std::norm(sum)).margin(1e-6));
+    }
+
+    // The tones of the key are far stronger than the others
+    for (std::size_t t = 0; t < tones.size(); ++t) {
+        if (t != 1 && t != 5) {
+            REQUIRE(bank.power(t) * 20 < bank.power(1));
+            REQUIRE(bank.power(t) * 20 < bank.power(5));
+        }
+    }
+    REQUIRE(bank.power(1) == Approx(n * n / 4.0).epsilon(0.1));
+}
+
+TEST_CASE("Blocks are reported at their boundaries however the input is split", "[goertzel]")
+{
+    const auto x = tone_pair(1000, 941, 1633);
+    auto whole = frequencypp::goertzel_bank<float>{tones.data(), tones.size(), 8_KHz, 300};
+    auto split = whole;
+    auto samples = std::vector<float>(x.begin(), x.end());
+
+    auto reported = std::vector<std::vector<float>>{};
+    REQUIRE(whole.process(samples.data(), samples.size(), [&](const float* p) {
+        reported.emplace_back(p, p + tones.size());
+    }) == 3);
+    REQUIRE(reported.size() == 3);
+    REQUIRE(reported.back()[3] == whole.power(3));
+
+    auto blocks = std::size_t{0};
+    auto i = std::size_t{0};
+    for (const auto piece : {1, 7, 250, 43, 300, 399}) {
+        const auto m = static_cast<std::size_t>(piece);
+        blocks += split.process(samples.data() + i, m, [&](const float* p) {
+            for (std::size_t t = 0; t < tones.size(); ++t) {
+                REQUIRE(p[t] == Approx(reported[blocks][t]).epsilon(1e-4));
+            }
+        });
+        i += m;
+    }
+    REQUIRE(blocks == 3);
+
+    // Discarding a partial block restarts the filters
+    split.process(samples.data(), 150);
+    split.reset();
+    split.process(samples.data(), 300);
+    REQUIRE(split.power(3) == Approx(reported[0][3]).epsilon(1e-4));
+}
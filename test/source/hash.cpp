@@ -0,0 +1,40 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/hash.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
+TEST_CASE("std::hash hashes the tick count", "[hash]")
+{
+    using namespace ::frequencypp;
+
+    REQUIRE(std::hash<hertz>{}(hertz{50}) == std::hash<std::int64_t>{}(50));
+    REQUIRE(std::hash<gigahertz>{}(gigahertz{2}) == std::hash<std::int32_t>{}(2));
+    REQUIRE(std::hash<frequency<double>>{}(frequency<double>{0.5}) == std::hash<double>{}(0.5));
+}
+
+TEST_CASE("frequencies are usable as unordered keys", "[hash]")
+{
+    using namespace ::frequencypp;
+
+    const auto rates = std::unordered_set<hertz>{hertz{44100}, hertz{48000}, hertz{44100}};
+    REQUIRE(rates.size() == 2);
+    REQUIRE(rates.count(hertz{48000}) == 1);
+    REQUIRE(rates.count(hertz{96000}) == 0);
+}
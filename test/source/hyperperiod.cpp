@@ -0,0 +1,99 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/frequency.hpp>
+#include <frequencypp/hyperperiod.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+
+using namespace frequencypp::literals;
+using namespace std::chrono_literals;
+
+TEST_CASE("Rates of a task set combine at compile time", "[hyperperiod]")
+{
+    static_assert(frequencypp::gcd(1_KHz, 400_Hz, 30_Hz) == 10_Hz);
+    static_assert(frequencypp::lcm(1_KHz, 400_Hz, 30_Hz) == 6_KHz);
+    static_assert(frequencypp::hyperperiod<std::chrono::milliseconds>(1_KHz, 400_Hz, 30_Hz)
+        == 100ms);
+    constexpr auto divisors = frequencypp::tick_divisors(1_KHz, 400_Hz, 30_Hz);
+    static_assert(divisors[0] == 6 && divisors[1] == 15 && divisors[2] == 200);
+
+    // A single rate is its own divisor and multiple
+    static_assert(frequencypp::gcd(50_Hz) == 50_Hz);
+    static_assert(frequencypp::lcm(-50_Hz) == 50_Hz);
+    static_assert(frequencypp::tick_divisors(50_Hz)[0] == 1);
+}
+
+TEST_CASE("Rates in mixed units combine exactly in their common type", "[hyperperiod]")
+{
+    using frequencypp::millihertz;
+    using frequencypp::nanohertz;
+
+    const auto g = frequencypp::gcd(1_KHz, 2500_mHz, 1_MHz);
+    STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(g)>, millihertz>);
+    REQUIRE(g == 2500_mHz);
+    REQUIRE(frequencypp::lcm(1_KHz, 2500_mHz, 1_MHz) == 1_MHz);
+    REQUIRE(frequencypp::hyperperiod<std::chrono::milliseconds>(1_KHz, 2500_mHz, 1_MHz) == 400ms);
+    REQUIRE(frequencypp::lcm(1_KHz, 2500_mHz) == 5_Hz * 200);
+
+    // Ten gigahertz is beyond the range of nanohertz, but the divisor is not
+    REQUIRE(frequencypp::gcd(10_GHz, 3_nHz) == nanohertz{1});
+    REQUIRE(frequencypp::hyperperiod<std::chrono::seconds>(10_GHz, 3_nHz) == 1000000000s);
+    REQUIRE(frequencypp::gcd(10_GHz, 4_GHz) == 2_GHz);
+}
+
+TEST_CASE("Unqualified calls on two rates are not taken by the standard library",
+    "[hyperperiod]")
+{
+    using namespace frequencypp;
+    using std::gcd;
+    using std::lcm;
+
+    // std is associated with the period of a frequency, so std::gcd and std::lcm are candidates
+    STATIC_REQUIRE(gcd(hertz{4}, hertz{6}) == hertz{2});
+    STATIC_REQUIRE(lcm(hertz{4}, hertz{6}) == hertz{12});
+    STATIC_REQUIRE(gcd(1_KHz, 2500_mHz) == 2500_mHz);
+    STATIC_REQUIRE(lcm(1_KHz, 2500_mHz) == 5_Hz * 200);
+    STATIC_REQUIRE(gcd(4, 6) == 2);
+}
+
+TEST_CASE("Rates known only at runtime combine exactly", "[hyperperiod]")
+{
+    const auto rates = std::array<frequencypp::millihertz, 5>{
+        1000000_mHz, 400000_mHz, 30000_mHz, 2500_mHz, 1000000_mHz};
+    REQUIRE(frequencypp::gcd(rates.data(), rates.size()) == 2500_mHz);
+    REQUIRE(frequencypp::lcm(rates.data(), rates.size()) == 6_KHz);
+    REQUIRE(frequencypp::hyperperiod<std::chrono::milliseconds>(rates.data(), rates.size())
+        == 400ms);
+
+    auto divisors = std::array<std::int64_t, 5>{};
+    const auto base = frequencypp::tick_divisors(rates.data(), rates.size(), divisors.data());
+    REQUIRE(base == 6_KHz);
+    REQUIRE(divisors == std::array<std::int64_t, 5>{6, 15, 200, 2400, 6});
+
+    // Products beyond 64 bits do not overflow when the multiple is representable
+    const auto coprime = std::array<frequencypp::nanohertz, 2>{
+        frequencypp::nanohertz{4000000007}, frequencypp::nanohertz{2000000011}};
+    REQUIRE(frequencypp::lcm(coprime.data(), coprime.size()).count()
+        == INT64_C(4000000007) * 2000000011);
+
+    REQUIRE(frequencypp::gcd(rates.data(), 0) == 0_mHz);
+    REQUIRE(frequencypp::lcm(rates.data(), 0) == 0_mHz);
+}
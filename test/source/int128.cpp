@@ -0,0 +1,139 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/frequency.hpp>
+#include <frequencypp/narrow_literals.hpp>
+#include <frequencypp/parse.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <functional>
+#include <ratio>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#if FREQUENCYPP_HAS_INT128
+
+namespace {
+
+using frequencypp::int128_t;
+using frequencypp::uint128_t;
+
+using wide_nanohertz = frequencypp::frequency<int128_t, std::nano>;
+using wide_unsigned_nanohertz = frequencypp::frequency<uint128_t, std::nano>;
+
+// 500THz in nanohertz, which is beyond std::int64_t
+constexpr auto optical = wide_nanohertz{int128_t{500000000000000} * 1000000000};
+
+template<typename T>
+auto to_string(const T& v, std::ios_base::fmtflags flags = {}) -> std::string
+{
+    std::ostringstream os;
+    os.flags(flags);
+    os << v;
+    return os.str();
+}
+
+} // namespace
+
+TEST_CASE("128-bit frequencies have the full range of their representation", "[int128]")
+{
+    STATIC_REQUIRE(wide_nanohertz::zero().count() == 0);
+    STATIC_REQUIRE(wide_nanohertz::max().count() == std::numeric_limits<int128_t>::max());
+    STATIC_REQUIRE(wide_nanohertz::min().count() == std::numeric_limits<int128_t>::lowest());
+    STATIC_REQUIRE(wide_unsigned_nanohertz::max().count() == std::numeric_limits<uint128_t>::max());
+}
+
+TEST_CASE("128-bit frequencies convert across periods beyond std::ratio", "[int128]")
+{
+    using namespace ::frequencypp;
+
+    // Nanohertz to terahertz spans 10^21, which std::ratio cannot represent
+    STATIC_REQUIRE(frequency_cast<terahertz>(optical) == terahertz{500});
+    STATIC_REQUIRE(frequency_cast<wide_nanohertz>(terahertz{500}) == optical);
+    STATIC_REQUIRE(frequency_cast<wide_nanohertz>(hertz{5}).count() == 5000000000);
+    STATIC_REQUIRE(optical + terahertz{1} == frequency_cast<wide_nanohertz>(terahertz{501}));
+    STATIC_REQUIRE(optical > terahertz{499});
+
+    using attoseconds = std::chrono::duration<int128_t, std::atto>;
+    constexpr auto period = duration_cast<attoseconds>(wide_nanohertz{int128_t{1000000000000}});
+    STATIC_REQUIRE(period.count() == 1000000000000000);
+    STATIC_REQUIRE(frequency_cast<wide_nanohertz>(period).count() == 1000000000000);
+    STATIC_REQUIRE(optical * std::chrono::nanoseconds{2} == 1000000);
+}
+
+TEST_CASE("128-bit frequencies support the numeric functions", "[int128]")
+{
+    using namespace ::frequencypp;
+
+    STATIC_REQUIRE(abs(-optical) == optical);
+    STATIC_REQUIRE(floor<hertz>(wide_nanohertz{1500000000}) == hertz{1});
+    STATIC_REQUIRE(ceil<hertz>(wide_nanohertz{1500000000}) == hertz{2});
+    STATIC_REQUIRE(round<hertz>(wide_nanohertz{1500000000}) == hertz{2});
+    STATIC_REQUIRE(round<hertz>(wide_nanohertz{2500000000}) == hertz{2});
+    STATIC_REQUIRE(ceil<hertz>(wide_unsigned_nanohertz{1}) == hertz{1});
+}
+
+TEST_CASE("128-bit frequencies are inserted into streams", "[int128]")
+{
+    REQUIRE(to_string(optical) == "500000000000000000000000nHz");
+    REQUIRE(to_string(-optical) == "-500000000000000000000000nHz");
+    REQUIRE(to_string(wide_nanohertz{0}) == "0nHz");
+    REQUIRE(to_string(wide_nanohertz{42}, std::ios::showpos) == "+42nHz");
+    REQUIRE(to_string(wide_nanohertz{255}, std::ios::hex) == "ffnHz");
+    REQUIRE(to_string(wide_nanohertz{255}, std::ios::hex | std::ios::showbase | std::ios::uppercase)
+        == "0XFFnHz");
+    REQUIRE(to_string(wide_nanohertz{8}, std::ios::oct | std::ios::showbase) == "010nHz");
+    REQUIRE(to_string(wide_nanohertz{-1}, std::ios::hex) == std::string(32, 'f') + "nHz");
+    REQUIRE(to_string(wide_unsigned_nanohertz::max())
+        == "340282366920938463463374607431768211455nHz");
+
+    std::wostringstream wos;
+    wos << optical;
+    REQUIRE(wos.str() == L"500000000000000000000000nHz");
+}
+
+TEST_CASE("128-bit frequencies are hashed", "[int128]")
+{
+    const auto hash = std::hash<wide_nanohertz>{};
+    REQUIRE(hash(optical) == hash(optical));
+    REQUIRE(hash(optical) != hash(optical + wide_nanohertz{1}));
+    REQUIRE(hash(wide_nanohertz{1}) != hash(wide_nanohertz{int128_t{1} << 64}));
+}
+
+TEST_CASE("128-bit frequencies are parsed", "[int128]")
+{
+    using namespace ::frequencypp;
+
+    constexpr auto carrier = FREQUENCYPP_FREQUENCY("193414.489032258064516129GHz");
+    STATIC_REQUIRE(std::is_same_v<decltype(carrier), const wide_nanohertz>);
+    STATIC_REQUIRE(carrier.count() == int128_t{193414489032258} * 1000000000 + 64516129);
+
+    constexpr auto narrow = FREQUENCYPP_FREQUENCY("1Hz");
+    STATIC_REQUIRE(std::is_same_v<decltype(narrow), const hertz>);
+}
+
+TEST_CASE("narrow literals widen to 128 bits", "[int128]")
+{
+    using namespace ::frequencypp::narrow_literals;
+    using ::frequencypp::frequency;
+
+    STATIC_REQUIRE(std::is_same_v<decltype(9223372036854775807_Hz), frequency<std::int64_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(9223372036854775808_Hz), frequency<int128_t>>);
+    STATIC_REQUIRE((500000000000000000000000_nHz) == optical);
+}
+
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/narrow_literals.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+TEST_CASE("narrow literals choose the narrowest signed representation", "[narrow_literals]")
+{
+    using namespace ::frequencypp::narrow_literals;
+    using ::frequencypp::frequency;
+
+    STATIC_REQUIRE(std::is_same_v<decltype(50_Hz), frequency<std::int8_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(127_Hz), frequency<std::int8_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(128_Hz), frequency<std::int16_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(32767_Hz), frequency<std::int16_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(32768_Hz), frequency<std::int32_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(2147483648_Hz), frequency<std::int64_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(0_Hz), frequency<std::int8_t>>);
+}
+
+TEST_CASE("narrow literals are sized in their own period", "[narrow_literals]")
+{
+    using namespace ::frequencypp::narrow_literals;
+    using ::frequencypp::frequency;
+
+    STATIC_REQUIRE(std::is_same_v<decltype(50_nHz), frequency<std::int8_t, std::nano>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(1_KHz), frequency<std::int8_t, std::kilo>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(2400_MHz), frequency<std::int16_t, std::mega>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(1_GHz), frequency<std::int8_t, std::giga>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(3_PHz), frequency<std::int8_t, std::peta>>);
+}
+
+TEST_CASE("narrow literals keep their values", "[narrow_literals]")
+{
+    using namespace ::frequencypp::narrow_literals;
+
+    STATIC_REQUIRE((50_Hz).count() == 50);
+    STATIC_REQUIRE((40000_Hz).count() == 40000);
+    STATIC_REQUIRE((5000000000_Hz).count() == 5000000000);
+    STATIC_REQUIRE((-50_Hz).count() == -50);
+}
+
+TEST_CASE("narrow literals accept every integer literal form", "[narrow_literals]")
+{
+    using namespace ::frequencypp::narrow_literals;
+    using ::frequencypp::frequency;
+
+    STATIC_REQUIRE((0_Hz).count() == 0);
+    STATIC_REQUIRE((0x7F_Hz).count() == 127);
+    STATIC_REQUIRE((0XfF_Hz).count() == 255);
+    STATIC_REQUIRE((0b1010_Hz).count() == 10);
+    STATIC_REQUIRE((017_Hz).count() == 15);
+    STATIC_REQUIRE((1'000'000_Hz).count() == 1000000);
+    STATIC_REQUIRE(std::is_same_v<decltype(0xFF_nHz), frequency<std::int16_t, std::nano>>);
+}
+
+TEST_CASE("narrow literals follow the common type rules", "[narrow_literals]")
+{
+    using namespace ::frequencypp::narrow_literals;
+    using ::frequencypp::frequency;
+    using ::frequencypp::hertz;
+    using ::frequencypp::kilohertz;
+
+    STATIC_REQUIRE(std::is_same_v<decltype(50_Hz + hertz{1}), hertz>);
+    STATIC_REQUIRE(std::is_same_v<decltype(50_Hz + 50_Hz), frequency<std::int8_t>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(50_Hz + 1000_Hz), frequency<int>>);
+
+    // Mixing units widens the common type to std::int64_t, so the conversion does not overflow
+    STATIC_REQUIRE(std::is_same_v<decltype(1_KHz + 1_Hz), hertz>);
+    STATIC_REQUIRE(1_KHz + 1_Hz == 1001_Hz);
+    STATIC_REQUIRE((1_KHz + 1_Hz).count() == 1001);
+    STATIC_REQUIRE((50_Hz + 1_KHz).count() == 1050);
+    STATIC_REQUIRE((1_mHz + 1_uHz).count() == 1001);
+    STATIC_REQUIRE((1_GHz - 1_nHz).count() == 999999999999999999);
+    STATIC_REQUIRE((2_Hz + 1_nHz).count() == 2000000001);
+    STATIC_REQUIRE(50_Hz + hertz{1} == hertz{51});
+    STATIC_REQUIRE(2_KHz == 2000_Hz);
+    STATIC_REQUIRE(1_KHz < kilohertz{2});
+
+    constexpr hertz widened = 50_Hz;
+    STATIC_REQUIRE(widened == hertz{50});
+}
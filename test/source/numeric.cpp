@@ -29,6 +29,12 @@ TEST_CASE("floor computes the correct tick count", "[numeric]")
     REQUIRE(floor<kilohertz>(-1999_Hz) == -2_KHz);
     REQUIRE(floor<kilohertz>(-2000_Hz) == -2_KHz);
     REQUIRE(floor<kilohertz>(-2001_Hz) == -3_KHz);
+
+    // Limits, where no adjustment is needed or computed
+    constexpr auto lowest = floor<hertz>(hertz::min());
+    constexpr auto highest = floor<hertz>(hertz::max());
+    STATIC_REQUIRE(lowest == hertz::min());
+    STATIC_REQUIRE(highest == hertz::max());
 }
 
 TEST_CASE("ceil computes the correct tick count", "[numeric]")
@@ -44,6 +50,12 @@ TEST_CASE("ceil computes the correct tick count", "[numeric]")
     REQUIRE(ceil<kilohertz>(-1999_Hz) == -1_KHz);
     REQUIRE(ceil<kilohertz>(-2000_Hz) == -2_KHz);
     REQUIRE(ceil<kilohertz>(-2001_Hz) == -2_KHz);
+
+    // Limits, where no adjustment is needed or computed
+    constexpr auto lowest = ceil<hertz>(hertz::min());
+    constexpr auto highest = ceil<hertz>(hertz::max());
+    STATIC_REQUIRE(lowest == hertz::min());
+    STATIC_REQUIRE(highest == hertz::max());
 }
 
 TEST_CASE("round computes the correct tick count", "[numeric]")
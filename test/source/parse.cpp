@@ -0,0 +1,77 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/parse.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+TEST_CASE("frequency strings parse to exact types", "[parse]")
+{
+    using namespace ::frequencypp;
+
+    constexpr auto crystal = FREQUENCYPP_FREQUENCY("32.768kHz");
+    STATIC_REQUIRE(std::is_same_v<decltype(crystal), const hertz>);
+    STATIC_REQUIRE(crystal.count() == 32768);
+
+    constexpr auto wifi = FREQUENCYPP_FREQUENCY("2.4GHz");
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(wifi), const frequency<std::int64_t, std::ratio<100000000>>>);
+    STATIC_REQUIRE(wifi.count() == 24);
+    STATIC_REQUIRE(wifi == megahertz{2400});
+
+    constexpr auto slow = FREQUENCYPP_FREQUENCY("0.5Hz");
+    STATIC_REQUIRE(std::is_same_v<decltype(slow), const frequency<std::int64_t, std::deci>>);
+    STATIC_REQUIRE(slow.count() == 5);
+}
+
+TEST_CASE("frequency strings accept prefixes and spacing", "[parse]")
+{
+    using namespace ::frequencypp;
+
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("1000Hz") == hertz{1000});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("100 MHz") == megahertz{100});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("7KHz") == kilohertz{7});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("3uHz") == microhertz{3});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("3\xC2\xB5Hz") == microhertz{3});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("1.5mHz") == microhertz{1500});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("4.THz") == terahertz{4});
+    STATIC_REQUIRE(FREQUENCYPP_FREQUENCY("1EHz") == petahertz{1000});
+}
+
+TEST_CASE("frequency strings are validated", "[parse]")
+{
+    using frequencypp::detail::parse_frequency;
+
+    STATIC_REQUIRE(parse_frequency("1Hz").valid);
+#if FREQUENCYPP_HAS_INT128
+    STATIC_REQUIRE(parse_frequency("170141183460469231731687303715884105727Hz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("170141183460469231731687303715884105728Hz").valid);
+#else
+    STATIC_REQUIRE(parse_frequency("9223372036854775807Hz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("9223372036854775808Hz").valid);
+#endif
+    STATIC_REQUIRE_FALSE(parse_frequency("Hz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency(".Hz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("1").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("1kHzz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("1xHz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("1.2.3Hz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("-1Hz").valid);
+    STATIC_REQUIRE(parse_frequency("10EHz").valid);
+    STATIC_REQUIRE_FALSE(parse_frequency("0.1aHz").valid);
+}
@@ -0,0 +1,148 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/fft.hpp>
+#include <frequencypp/frequency.hpp>
+#include <frequencypp/peaks.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+using namespace frequencypp::literals;
+using frequencypp::peak_interpolation;
+
+namespace {
+
+constexpr auto pi = 3.14159265358979323846;
+
+using millihertz_peak = frequencypp::spectral_peak<frequencypp::millihertz, double>;
+
+} // namespace
+
+TEST_CASE("Parabolic interpolation recovers the vertex of a parabolic peak", "[peaks]")
+{
+    // Vertex at bin 10.25 with height 5
+    auto m = std::vector<double>(32);
+    for (std::size_t i = 0; i < m.size(); ++i) {
+        const auto d = static_cast<double>(i) - 10.25;
+        m[i] = std::max(5 - 0.5 * d * d, 0.0);
+    }
+    auto peaks = std::array<millihertz_peak, 4>{};
+    const auto n = frequencypp::find_peaks(m.data(), m.size(), 100_Hz, 2_Hz, 0.0, peaks.data(), 4);
+    REQUIRE(n == 1);
+    REQUIRE(peaks[0].frequency == 120500_mHz);
+    REQUIRE(peaks[0].magnitude == Approx(5));
+}
+
+TEST_CASE("Gaussian interpolation recovers the centre of a Gaussian peak", "[peaks]")
+{
+    auto m = std::vector<double>(64);
+    for (std::size_t i = 0; i < m.size(); ++i) {
+        const auto d = static_cast<double>(i) - 40.6;
+        m[i] = 3 * std::exp(-d * d / 8);
+    }
+    auto peak = frequencypp::spectral_peak<frequencypp::frequency<double>, double>{};
+    const auto n = frequencypp::find_peaks(
+        m.data(), m.size(), 0_Hz, 1_Hz, 0.0, &peak, 1, peak_interpolation::gaussian);
+    REQUIRE(n == 1);
+    REQUIRE(peak.frequency.count() == Approx(40.6));
+    REQUIRE(peak.magnitude == Approx(3));
+
+    // The parabolic model is close but biased for the same peak
+    frequencypp::find_peaks(m.data(), m.size(), 0_Hz, 1_Hz, 0.0, &peak, 1);
+    REQUIRE(std::abs(peak.frequency.count() - 40.6) > 1e-3);
+    REQUIRE(std::abs(peak.frequency.count() - 40.6) < 0.05);
+}
+
+TEST_CASE("The strongest peaks above the threshold are returned strongest first", "[peaks]")
+{
+    // Isolated peaks at every fifth bin, whose heights cycle so that many tie with others; the
+    // number of bins leaves a tail that is not a whole vector
+    auto m = std::vector<float>(1003);
+    auto expected = std::vector<float>{};
+    for (std::size_t i = 2; i + 1 < m.size(); i += 5) {
+        m[i] = static_cast<float>(i * 37 % 101);
+        if (m[i] > 10) {
+            expected.push_back(m[i]);
+        }
+    }
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    auto peaks = std::vector<frequencypp::spectral_peak<frequencypp::hertz, float>>(8);
+    const auto n = frequencypp::find_peaks(
+        m.data(), m.size(), 0_Hz, 1_Hz, 10.0F, peaks.data(), peaks.size());
+    REQUIRE(n == peaks.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(peaks[i].magnitude == Approx(expected[i]));
+        REQUIRE(m[static_cast<std::size_t>(peaks[i].frequency.count())] == expected[i]);
+    }
+
+    // Room for more peaks than there are returns all of them
+    peaks.resize(expected.size() + 10);
+    REQUIRE(frequencypp::find_peaks(m.data(), m.size(), 0_Hz, 1_Hz, 10.0F, peaks.data(),
+                peaks.size())
+        == expected.size());
+}
+
+TEST_CASE("Edges, plateaus, and degenerate inputs are not peaks", "[peaks]")
+{
+    auto peak = millihertz_peak{};
+    const auto rising = std::array<double, 5>{1, 2, 3, 4, 5};
+    REQUIRE(frequencypp::find_peaks(rising.data(), rising.size(), 0_Hz, 1_Hz, 0.0, &peak, 1) == 0);
+    REQUIRE(frequencypp::find_peaks(rising.data(), 2, 0_Hz, 1_Hz, 0.0, &peak, 1) == 0);
+
+    // A plateau yields its lowest bin only
+    const auto plateau = std::array<double, 6>{0, 1, 2, 2, 1, 0};
+    REQUIRE(frequencypp::find_peaks(plateau.data(), plateau.size(), 0_Hz, 1_Hz, 0.0, &peak, 1)
+        == 1);
+    REQUIRE(peak.frequency == 2500_mHz);
+    REQUIRE(frequencypp::find_peaks(plateau.data(), plateau.size(), 0_Hz, 1_Hz, 0.0, &peak, 0)
+        == 0);
+    REQUIRE(frequencypp::find_peaks(plateau.data(), plateau.size(), 0_Hz, 1_Hz, 2.0, &peak, 1)
+        == 0);
+}
+
+TEST_CASE("Peaks of a spectrum are located between its bins", "[peaks]")
+{
+    // Hann-windowed tones between bins, whose spectral peaks are closely Gaussian
+    constexpr auto n = std::size_t{4096};
+    const auto tones = std::array<double, 2>{1234.5678, 9876.54321};
+    auto x = std::vector<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto t = static_cast<double>(i) / 48000;
+        const auto window = 0.5 - 0.5 * std::cos(2 * pi * static_cast<double>(i) / n);
+        x[i] = window * (std::sin(2 * pi * tones[0] * t) + 0.5 * std::sin(2 * pi * tones[1] * t));
+    }
+    const auto plan = frequencypp::make_fft_plan<n>(48_KHz);
+    const auto s = plan(x.data());
+    auto m = std::vector<double>(s.size());
+    for (std::size_t k = 0; k < s.size(); ++k) {
+        m[k] = s.magnitude(k);
+    }
+
+    auto peaks = std::array<millihertz_peak, 2>{};
+    REQUIRE(frequencypp::find_peaks(m.data(), m.size(), 0_Hz, s.resolution(), 1.0, peaks.data(),
+                peaks.size(), peak_interpolation::gaussian)
+        == 2);
+    const auto resolution = frequencypp::frequency_cast<frequencypp::millihertz>(s.resolution());
+    REQUIRE(frequencypp::abs(peaks[0].frequency - 1234568_mHz) < resolution / 20);
+    REQUIRE(frequencypp::abs(peaks[1].frequency - 9876543_mHz) < resolution / 20);
+    REQUIRE(peaks[0].magnitude > peaks[1].magnitude);
+}
@@ -0,0 +1,184 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/frequency.hpp>
+#include <frequencypp/pll.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if FREQUENCYPP_HAS_INT128
+
+using namespace frequencypp::literals;
+
+namespace {
+
+struct configuration
+{
+    frequencypp::uint128_t deviation; // |reference * N - target * M * D|
+    std::uint64_t md;
+    std::uint64_t n;
+    std::uint64_t d;
+};
+
+// Every acceptable configuration, in the planner's order of increasing error relative to M * D
+auto brute_force(std::int64_t reference, std::int64_t target, std::int64_t vco_min,
+    std::int64_t vco_max, const frequencypp::pll_constraints& c) -> std::vector<configuration>
+{
+    auto all = std::vector<configuration>{};
+    for (auto n = c.multiplier.min; n <= c.multiplier.max; ++n) {
+        for (auto m = c.divider.min; m <= c.divider.max; ++m) {
+            const auto vco = static_cast<long double>(reference) * n / m;
+            if (vco < vco_min || vco > vco_max) {
+                continue;
+            }
+            for (auto d = c.output_divider.min; d <= c.output_divider.max; ++d) {
+                using frequencypp::uint128_t;
+                const auto achieved = uint128_t{static_cast<std::uint64_t>(reference)} * n;
+                const auto exact = uint128_t{static_cast<std::uint64_t>(target)} * m * d;
+                const auto deviation = achieved > exact ? achieved - exact : exact - achieved;
+                if (static_cast<long double>(deviation) / static_cast<long double>(exact)
+                    <= c.tolerance_ppm * 1e-6L)
+                {
+                    all.push_back({deviation, m * d, n, d});
+                }
+            }
+        }
+    }
+    std::sort(all.begin(), all.end(), [](const configuration& a, const configuration& b) {
+        const auto l = a.deviation * b.md;
+        const auto r = b.deviation * a.md;
+        return std::tie(l, a.md, a.n, a.d) < std::tie(r, b.md, b.n, b.d);
+    });
+    return all;
+}
+
+} // namespace
+
+TEST_CASE("Exact configurations are found and converted exactly", "[pll]")
+{
+    auto c = frequencypp::pll_constraints{};
+    c.multiplier = {8, 400};
+    c.divider = {1, 10};
+    c.output_divider = {1, 64};
+    const auto plan = frequencypp::plan_pll(25_MHz, 148500_KHz, 600_MHz, 1200_MHz, c);
+    using solution = decltype(plan)::value_type;
+    static_assert(std::is_same_v<solution::frequency_type, frequencypp::kilohertz>);
+    REQUIRE(!plan.empty());
+    for (const auto& s : plan) {
+        REQUIRE(s.error_ppm == 0);
+        REQUIRE(s.achieved() == 148500_KHz);
+        REQUIRE(s.numerator == s.denominator * 148500);
+        REQUIRE(s.vco() >= 600_MHz);
+        REQUIRE(s.vco() <= 1200_MHz);
+        REQUIRE(25000 * s.multiplier == 148500 * s.divider * s.output_divider);
+    }
+    // 148.5 / 25 is 297 / 50, and the oscillator range requires D of 5 to 8
+    REQUIRE(plan.front().divider * plan.front().output_divider == 50);
+}
+
+TEST_CASE("Inexact configurations are ranked by their exact error", "[pll]")
+{
+    auto c = frequencypp::pll_constraints{};
+    c.multiplier = {10, 300};
+    c.divider = {1, 12};
+    c.output_divider = {1, 40};
+    c.tolerance_ppm = 2000;
+    c.max_solutions = 25;
+    const auto plan = frequencypp::plan_pll(19200_KHz, 44100_Hz * 512, 400_MHz, 900_MHz, c);
+    const auto expected = brute_force(19200000, 22579200, 400000000, 900000000, c);
+    REQUIRE(plan.size() == std::min<std::size_t>(expected.size(), 25));
+    for (std::size_t i = 0; i < plan.size(); ++i) {
+        REQUIRE(plan[i].multiplier == expected[i].n);
+        REQUIRE(plan[i].divider * plan[i].output_divider == expected[i].md);
+        REQUIRE(plan[i].output_divider == expected[i].d);
+        const auto exact = plan[i].denominator * 22579200;
+        const auto n = plan[i].numerator;
+        REQUIRE(((n > exact ? n - exact : exact - n) == expected[i].deviation));
+        REQUIRE(std::fabs(plan[i].error_ppm) <= 2000);
+    }
+
+    // The exact quotient converts to any frequency type
+    const auto& best = plan.front();
+    const auto exact = static_cast<long double>(best.numerator) / best.denominator;
+    REQUIRE(best.achieved<frequencypp::frequency<long double>>().count() == Approx(exact));
+    REQUIRE(best.achieved<frequencypp::millihertz>().count() == std::llround(exact * 1000));
+}
+
+TEST_CASE("Searches divided between threads agree with a single thread", "[pll]")
+{
+    auto c = frequencypp::pll_constraints{};
+    c.multiplier = {1, 5000};
+    c.divider = {1, 1000};
+    c.output_divider = {1, 500};
+    c.tolerance_ppm = 0.5;
+    c.max_solutions = 16;
+    c.threads = 1;
+    const auto single = frequencypp::plan_pll(27_MHz, 74175824_Hz, 1_GHz, 3_GHz, c);
+    c.threads = 4;
+    const auto threaded = frequencypp::plan_pll(27_MHz, 74175824_Hz, 1_GHz, 3_GHz, c);
+    REQUIRE(single.size() == 16);
+    REQUIRE(threaded.size() == single.size());
+    for (std::size_t i = 0; i < single.size(); ++i) {
+        REQUIRE(threaded[i].multiplier == single[i].multiplier);
+        REQUIRE(threaded[i].divider == single[i].divider);
+        REQUIRE(threaded[i].output_divider == single[i].output_divider);
+        REQUIRE(std::fabs(single[i].error_ppm) <= 0.5);
+    }
+    for (std::size_t i = 1; i < single.size(); ++i) {
+        REQUIRE(std::fabs(single[i - 1].error_ppm) <= std::fabs(single[i].error_ppm));
+    }
+}
+
+TEST_CASE("Unreachable targets yield no configurations", "[pll]")
+{
+    auto c = frequencypp::pll_constraints{};
+    c.multiplier = {1, 100};
+    c.divider = {1, 10};
+    c.output_divider = {1, 10};
+    // The oscillator range cannot be reached from the reference
+    REQUIRE(frequencypp::plan_pll(10_MHz, 100_MHz, 2_GHz, 3_GHz, c).empty());
+    // 1 / 7 of the reference needs M * D = 7k, but no N / (M * D) in range is that exactly
+    c.output_divider = {1, 1};
+    c.divider = {1, 6};
+    REQUIRE(frequencypp::plan_pll(7_MHz, 1_MHz, 0_Hz, 1_GHz, c).empty());
+    c.max_solutions = 0;
+    REQUIRE(frequencypp::plan_pll(10_MHz, 10_MHz, 0_Hz, 1_GHz, c).empty());
+}
+
+TEST_CASE("Factor ranges admitting only zero yield no configurations", "[pll]")
+{
+    auto c = frequencypp::pll_constraints{};
+    c.multiplier = {1, 100};
+    c.divider = {0, 0};
+    c.output_divider = {1, 4};
+    REQUIRE(frequencypp::plan_pll(25_MHz, 100_MHz, 50_MHz, 1000_MHz, c).empty());
+    c.divider = {1, 4};
+    c.multiplier = {0, 0};
+    REQUIRE(frequencypp::plan_pll(25_MHz, 100_MHz, 50_MHz, 1000_MHz, c).empty());
+    c.multiplier = {1, 100};
+    c.output_divider = {0, 0};
+    REQUIRE(frequencypp::plan_pll(25_MHz, 100_MHz, 50_MHz, 1000_MHz, c).empty());
+    // The same constraints with nonzero factors do reach the target
+    c.output_divider = {1, 4};
+    REQUIRE_FALSE(frequencypp::plan_pll(25_MHz, 100_MHz, 50_MHz, 1000_MHz, c).empty());
+}
+
+#endif
@@ -0,0 +1,191 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/saturating.hpp>
+#include <frequencypp/frequency_io.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+using sat16 = frequencypp::saturating<std::int16_t>;
+using satu8 = frequencypp::saturating<std::uint8_t>;
+using sat_petahertz = frequencypp::frequency<sat16, std::peta>;
+
+constexpr auto max16 = std::numeric_limits<std::int16_t>::max();
+constexpr auto min16 = std::numeric_limits<std::int16_t>::min();
+
+} // namespace
+
+TEST_CASE("saturating values clamp on construction", "[saturating]")
+{
+    REQUIRE(sat16{100000}.value() == max16);
+    REQUIRE(sat16{-100000}.value() == min16);
+    REQUIRE(sat16{1234}.value() == 1234);
+    REQUIRE(satu8{-1}.value() == 0);
+    REQUIRE(satu8{300U}.value() == 255);
+    REQUIRE(sat16{frequencypp::saturating<std::int64_t>{1 << 20}}.value() == max16);
+}
+
+TEST_CASE("saturating arithmetic clamps instead of wrapping", "[saturating]")
+{
+    REQUIRE((sat16{max16} + sat16{1}).value() == max16);
+    REQUIRE((sat16{min16} - sat16{1}).value() == min16);
+    REQUIRE((sat16{max16} - sat16{-1}).value() == max16);
+    REQUIRE((sat16{20000} * sat16{2}).value() == max16);
+    REQUIRE((sat16{20000} * sat16{-2}).value() == min16);
+    REQUIRE((sat16{-20000} * sat16{-2}).value() == max16);
+    REQUIRE((sat16{min16} / sat16{-1}).value() == max16);
+    REQUIRE((sat16{min16} % sat16{-1}).value() == 0);
+    REQUIRE((-sat16{min16}).value() == max16);
+    REQUIRE((satu8{10} - satu8{20}).value() == 0);
+    REQUIRE((satu8{200} + satu8{100}).value() == 255);
+    REQUIRE((satu8{200} * satu8{2}).value() == 255);
+    REQUIRE((sat16{7} / sat16{2}).value() == 3);
+    REQUIRE((sat16{7} % sat16{2}).value() == 1);
+}
+
+TEST_CASE("saturating arithmetic is usable in constant expressions", "[saturating]")
+{
+    constexpr auto s = sat16{max16} + sat16{1};
+    STATIC_REQUIRE(s.value() == max16);
+    constexpr auto f = sat_petahertz::max() + sat_petahertz{1};
+    STATIC_REQUIRE(f.count() == sat_petahertz::max().count());
+}
+
+TEST_CASE("saturating frequencies clamp on increment and compound assignment", "[saturating]")
+{
+    auto f1 = sat_petahertz::max();
+    ++f1;
+    REQUIRE(f1.count().value() == max16);
+    f1++;
+    REQUIRE(f1.count().value() == max16);
+    f1 += sat_petahertz{1};
+    REQUIRE(f1.count().value() == max16);
+    f1 *= 2;
+    REQUIRE(f1.count().value() == max16);
+
+    auto f2 = sat_petahertz::min();
+    --f2;
+    REQUIRE(f2.count().value() == min16);
+    f2 -= sat_petahertz{1};
+    REQUIRE(f2.count().value() == min16);
+}
+
+TEST_CASE("saturating frequencies clamp in the free arithmetic operators", "[saturating]")
+{
+    using namespace ::frequencypp;
+
+    auto f1 = sat_petahertz{30000} + sat_petahertz{30000};
+    REQUIRE(std::is_same_v<decltype(f1), sat_petahertz>);
+    REQUIRE(f1.count().value() == max16);
+
+    auto f2 = sat_petahertz{30000} * 4;
+    REQUIRE(std::is_same_v<decltype(f2)::rep, saturating<int>>);
+    REQUIRE(f2.count().value() == 120000);
+
+    auto f3 = 2 * sat_petahertz{30000};
+    REQUIRE(f3.count().value() == 60000);
+
+    // Mixing with a plain representation saturates in the common representation
+    auto f4 = sat_petahertz{1} + 1_Hz;
+    REQUIRE(std::is_same_v<decltype(f4)::rep, saturating<std::int64_t>>);
+    REQUIRE(f4.count().value() == 1'000'000'000'000'001);
+}
+
+TEST_CASE("saturating frequencies clamp when cast", "[saturating]")
+{
+    using namespace ::frequencypp;
+    using sat_hertz = frequency<saturating<std::int64_t>>;
+    using sat_kilohertz = frequency<saturating<std::int16_t>, std::kilo>;
+
+    REQUIRE(frequency_cast<sat_kilohertz>(sat_hertz{1'000'000'000}).count().value() == max16);
+    REQUIRE(frequency_cast<sat_kilohertz>(sat_hertz{-1'000'000'000}).count().value() == min16);
+    REQUIRE(frequency_cast<sat_kilohertz>(sat_hertz{12'345'678}).count().value() == 12345);
+    REQUIRE(frequency_cast<sat_hertz>(sat_petahertz{max16}).count().value()
+        == std::numeric_limits<std::int64_t>::max());
+    REQUIRE(frequency_cast<kilohertz>(sat_hertz{5000}) == 5_KHz);
+}
+
+TEST_CASE("saturating frequencies compare and print like their values", "[saturating]")
+{
+    using namespace ::frequencypp;
+
+    REQUIRE(sat_petahertz{1} == 1_PHz);
+    REQUIRE(sat_petahertz{1} < sat_petahertz{2});
+    REQUIRE(abs(sat_petahertz{-5}) == sat_petahertz{5});
+    REQUIRE(abs(sat_petahertz::min()) == sat_petahertz::max());
+
+    auto s = std::ostringstream{};
+    s << sat_petahertz{-12};
+    REQUIRE(s.str() == "-12PHz");
+
+    auto s8 = std::ostringstream{};
+    s8 << frequency<saturating<std::int8_t>>{65};
+    REQUIRE(s8.str() == "65Hz");
+}
+
+TEST_CASE("saturating frequency values are the clamping limits", "[saturating]")
+{
+    REQUIRE(sat_petahertz::zero().count().value() == 0);
+    REQUIRE(sat_petahertz::min().count().value() == min16);
+    REQUIRE(sat_petahertz::max().count().value() == max16);
+}
+
+TEST_CASE("saturating span arithmetic clamps each element", "[saturating]")
+{
+    using namespace ::frequencypp;
+
+    auto lhs = std::array<sat_petahertz, 5>{sat_petahertz{max16},
+        sat_petahertz{min16},
+        sat_petahertz{5},
+        sat_petahertz{-5},
+        sat_petahertz{30000}};
+    auto rhs = std::array<sat_petahertz, 5>{sat_petahertz{1},
+        sat_petahertz{-1},
+        sat_petahertz{7},
+        sat_petahertz{max16},
+        sat_petahertz{-30000}};
+    auto out = std::array<sat_petahertz, 5>{};
+
+    saturating_add(lhs.data(), rhs.data(), out.data(), out.size());
+    REQUIRE(out[0].count().value() == max16);
+    REQUIRE(out[1].count().value() == min16);
+    REQUIRE(out[2].count().value() == 12);
+    REQUIRE(out[3].count().value() == max16 - 5);
+    REQUIRE(out[4].count().value() == 0);
+
+    saturating_sub(lhs.data(), rhs.data(), out.data(), out.size());
+    REQUIRE(out[0].count().value() == max16 - 1);
+    REQUIRE(out[1].count().value() == min16 + 1);
+    REQUIRE(out[2].count().value() == -2);
+    REQUIRE(out[3].count().value() == min16);
+    REQUIRE(out[4].count().value() == max16);
+
+    using satu_hertz = frequency<saturating<std::uint32_t>>;
+    auto ulhs = std::array<satu_hertz, 2>{satu_hertz{4'000'000'000U}, satu_hertz{1U}};
+    auto urhs = std::array<satu_hertz, 2>{satu_hertz{400'000'000U}, satu_hertz{2U}};
+    auto uout = std::array<satu_hertz, 2>{};
+    saturating_add(ulhs.data(), urhs.data(), uout.data(), uout.size());
+    REQUIRE(uout[0].count().value() == std::numeric_limits<std::uint32_t>::max());
+    REQUIRE(uout[1].count().value() == 3U);
+    saturating_sub(ulhs.data(), urhs.data(), uout.data(), uout.size());
+    REQUIRE(uout[0].count().value() == 3'600'000'000U);
+    REQUIRE(uout[1].count().value() == 0U);
+}
@@ -0,0 +1,148 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/simd.hpp>
+
+#if FREQUENCYPP_HAS_SIMD
+
+#include <frequencypp/frequency_io.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+
+// The vectors in these tests may be wider than the registers of the target
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace {
+
+using int4 = frequencypp::simd<std::int64_t, 4>;
+using double4 = frequencypp::simd<double, 4>;
+using hertz4 = frequencypp::frequency<int4>;
+using kilohertz4 = frequencypp::frequency<int4, std::kilo>;
+
+constexpr auto lanes(std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d) -> int4
+{
+    return int4{typename int4::native_type{a, b, c, d}};
+}
+
+template<typename T, std::size_t N>
+auto same_lanes(const frequencypp::simd<T, N>& v, const frequencypp::simd<T, N>& w) -> bool
+{
+    return frequencypp::all_of(v == w);
+}
+
+} // namespace
+
+TEST_CASE("simd values operate lane-wise", "[simd]")
+{
+    const auto v = lanes(1, -2, 3, -4);
+    REQUIRE(same_lanes(v + 1, lanes(2, -1, 4, -3)));
+    REQUIRE(same_lanes(v * v, lanes(1, 4, 9, 16)));
+    REQUIRE(same_lanes(-v, lanes(-1, 2, -3, 4)));
+    REQUIRE(same_lanes(v % 2, lanes(1, 0, 1, 0)));
+    REQUIRE(same_lanes(int4{[](std::size_t i) { return i * 10; }}, lanes(0, 10, 20, 30)));
+
+    const auto d = double4{v} / 2;
+    REQUIRE(d[0] == 0.5);
+    REQUIRE(d[3] == -2.0);
+
+    std::int64_t raw[4] = {5, 6, 7, 8};
+    auto loaded = int4{};
+    loaded.copy_from(raw);
+    REQUIRE(same_lanes(loaded, lanes(5, 6, 7, 8)));
+    (loaded * 2).copy_to(raw);
+    REQUIRE(raw[3] == 16);
+}
+
+TEST_CASE("simd comparisons return masks", "[simd]")
+{
+    const auto m = lanes(1, 5, 3, 7) < lanes(2, 4, 3, 8);
+    REQUIRE(m[0]);
+    REQUIRE_FALSE(m[1]);
+    REQUIRE_FALSE(m[2]);
+    REQUIRE(m[3]);
+    REQUIRE(frequencypp::any_of(m));
+    REQUIRE_FALSE(frequencypp::all_of(m));
+    REQUIRE(frequencypp::none_of(m && !m));
+    REQUIRE(frequencypp::all_of(m || !m));
+}
+
+TEST_CASE("simd frequencies convert lane-wise", "[simd]")
+{
+    const auto k = kilohertz4{lanes(1, 2, 3, 4)};
+    const hertz4 h = k;
+    REQUIRE(same_lanes(h.count(), lanes(1000, 2000, 3000, 4000)));
+    REQUIRE(same_lanes(
+        frequencypp::frequency_cast<kilohertz4>(hertz4{lanes(1999, -1999, 0, 1)}).count(),
+        lanes(1, -1, 0, 0)));
+
+    using double_kilohertz4 = frequencypp::frequency<double4, std::kilo>;
+    const auto d = frequencypp::frequency_cast<double_kilohertz4>(hertz4{lanes(1500, 0, 1, 4)});
+    REQUIRE(d.count()[0] == 1.5);
+    REQUIRE(d.count()[2] == 0.001);
+}
+
+TEST_CASE("simd frequency arithmetic and comparisons are lane-wise", "[simd]")
+{
+    const auto h = hertz4{lanes(500, 1000, 1500, 2000)};
+    const auto k = kilohertz4{lanes(1, 1, 1, 1)};
+    STATIC_REQUIRE(std::is_same_v<decltype(h + k), hertz4>);
+    REQUIRE(same_lanes((h + k).count(), lanes(1500, 2000, 2500, 3000)));
+    REQUIRE(same_lanes((h * 2).count(), lanes(1000, 2000, 3000, 4000)));
+    REQUIRE(same_lanes((h / k), lanes(0, 1, 1, 2)));
+
+    const auto eq = h == k;
+    STATIC_REQUIRE(std::is_same_v<std::decay_t<decltype(eq)>, int4::mask_type>);
+    REQUIRE_FALSE(eq[0]);
+    REQUIRE(eq[1]);
+    const auto ge = h >= k;
+    REQUIRE_FALSE(ge[0]);
+    REQUIRE(ge[1]);
+    REQUIRE(ge[3]);
+}
+
+TEST_CASE("simd frequencies round lane-wise", "[simd]")
+{
+    const auto h = hertz4{lanes(1500, 2500, -1400, -1600)};
+    REQUIRE(same_lanes(frequencypp::floor<kilohertz4>(h).count(), lanes(1, 2, -2, -2)));
+    REQUIRE(same_lanes(frequencypp::ceil<kilohertz4>(h).count(), lanes(2, 3, -1, -1)));
+    REQUIRE(same_lanes(frequencypp::round<kilohertz4>(h).count(), lanes(2, 2, -1, -2)));
+    REQUIRE(same_lanes(frequencypp::abs(h).count(), lanes(1500, 2500, 1400, 1600)));
+
+    using int32_kilohertz4 = frequencypp::frequency<frequencypp::simd<std::int32_t, 4>, std::kilo>;
+    REQUIRE(frequencypp::floor<int32_kilohertz4>(h).count()[2] == -2);
+}
+
+TEST_CASE("simd frequencies take their limits from the lanes", "[simd]")
+{
+    REQUIRE(same_lanes(hertz4::zero().count(), int4{0}));
+    REQUIRE(hertz4::max().count()[2] == std::numeric_limits<std::int64_t>::max());
+    STATIC_REQUIRE(std::chrono::treat_as_floating_point_v<double4>);
+    STATIC_REQUIRE_FALSE(std::chrono::treat_as_floating_point_v<int4>);
+}
+
+TEST_CASE("simd frequencies are inserted lane by lane", "[simd]")
+{
+    auto os = std::ostringstream{};
+    os << kilohertz4{lanes(1, 2, 3, 4)};
+    REQUIRE(os.str() == "{1, 2, 3, 4}KHz");
+}
+
+#endif
@@ -0,0 +1,115 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/tick_clock.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+struct fake_source
+{
+    static inline std::uint64_t ticks = 0;
+    static inline int reads = 0;
+
+    static auto read() noexcept -> std::uint64_t
+    {
+        ++reads;
+        return ticks;
+    }
+};
+
+struct fake_relaxed_source
+{
+    static constexpr bool is_steady = true;
+    static inline std::uint64_t ticks = 0;
+    static inline int relaxed_reads = 0;
+
+    static auto read() noexcept -> std::uint64_t
+    {
+        return ticks;
+    }
+
+    static auto read_relaxed() noexcept -> std::uint64_t
+    {
+        ++relaxed_reads;
+        return ticks;
+    }
+};
+
+using timer_rate = frequencypp::frequency_constant<frequencypp::kilohertz, 19'200>;
+using rtc_rate = frequencypp::frequency_constant<frequencypp::hertz, 32'768>;
+using timer_clock = frequencypp::tick_clock<timer_rate, fake_source>;
+using rtc_clock = frequencypp::tick_clock<rtc_rate, fake_relaxed_source>;
+
+} // namespace
+
+TEST_CASE("tick clock period is the reciprocal of its frequency", "[tick_clock]")
+{
+    STATIC_REQUIRE(std::ratio_equal_v<timer_clock::period, std::ratio<1, 19'200'000>>);
+    STATIC_REQUIRE(std::ratio_equal_v<rtc_clock::period, std::ratio<1, 32'768>>);
+    STATIC_REQUIRE(timer_clock::rate() == frequencypp::kilohertz{19'200});
+    STATIC_REQUIRE_FALSE(timer_clock::is_steady);
+    STATIC_REQUIRE(rtc_clock::is_steady);
+}
+
+TEST_CASE("tick clock durations convert at compile time", "[tick_clock]")
+{
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using std::chrono::seconds;
+
+    STATIC_REQUIRE(duration_cast<nanoseconds>(timer_clock::duration{192}) == nanoseconds{10'000});
+    STATIC_REQUIRE(duration_cast<seconds>(rtc_clock::duration{32'768 * 3}) == seconds{3});
+    STATIC_REQUIRE(rtc_clock::duration{seconds{2}}.count() == 65'536);
+}
+
+TEST_CASE("tick clock reads its counter source", "[tick_clock]")
+{
+    fake_source::ticks = 19'200'000;
+    const auto t0 = timer_clock::now();
+    fake_source::ticks += 1'920;
+    const auto t1 = timer_clock::now();
+    REQUIRE(t0.time_since_epoch().count() == 19'200'000);
+    REQUIRE(t1 - t0 == std::chrono::microseconds{100});
+
+    // The source has no relaxed read, so the ordered read is used
+    const auto reads = fake_source::reads;
+    static_cast<void>(timer_clock::now_relaxed());
+    REQUIRE(fake_source::reads == reads + 1);
+}
+
+TEST_CASE("tick clock uses the relaxed read when available", "[tick_clock]")
+{
+    fake_relaxed_source::ticks = 16'384;
+    const auto t = rtc_clock::now_relaxed();
+    REQUIRE(fake_relaxed_source::relaxed_reads == 1);
+    REQUIRE(t.time_since_epoch() == std::chrono::milliseconds{500});
+}
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+TEST_CASE("tick clock reads the time-stamp counter", "[tick_clock]")
+{
+    using tsc_rate = frequencypp::frequency_constant<frequencypp::megahertz, 3000>;
+    using tsc_clock = frequencypp::tick_clock<tsc_rate, frequencypp::x86_tsc_source>;
+    const auto t0 = tsc_clock::now();
+    const auto t1 = tsc_clock::now_relaxed();
+    const auto t2 = tsc_clock::now();
+    REQUIRE(t0 <= t2);
+    static_cast<void>(t1);
+}
+#endif
@@ -0,0 +1,118 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/tick_converter.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+// Spreads test inputs over [0, limit] deterministically
+auto sample(std::uint64_t i, std::uint64_t limit) -> std::uint64_t
+{
+    return limit / 1000 * i + (i * 2654435761U) % 1000;
+}
+
+auto distance(std::uint64_t a, std::uint64_t b) -> std::uint64_t
+{
+    return a > b ? a - b : b - a;
+}
+
+} // namespace
+
+TEST_CASE("tick converter stays within its error bound", "[tick_converter]")
+{
+    using namespace ::frequencypp;
+
+    // 19.2 MHz, where one tick is exactly 625/12 ns
+    const auto c = tick_converter<>{19'200_KHz};
+    REQUIRE(c.max_ticks() >= std::uint64_t{600} * 19'200'000);
+    REQUIRE(c.max_error() < std::chrono::microseconds{1});
+    for (std::uint64_t i = 0; i <= 1000; ++i) {
+        const auto ticks = sample(i, c.max_ticks());
+        const auto exact = (ticks * 625 + 6) / 12;
+        const auto ns = static_cast<std::uint64_t>(c.to_duration(ticks).count());
+        REQUIRE(distance(ns, exact) <= static_cast<std::uint64_t>(c.max_error().count()));
+    }
+}
+
+TEST_CASE("tick converter handles measured floating-point frequencies", "[tick_converter]")
+{
+    using namespace ::frequencypp;
+
+    const auto rate = frequency<double>{2'893'412'345.6};
+    const auto c = tick_converter<std::chrono::nanoseconds>{rate, std::chrono::seconds{60}};
+    REQUIRE(c.max_duration() >= std::chrono::seconds{60});
+    for (std::uint64_t i = 0; i <= 1000; ++i) {
+        const auto ticks = sample(i, c.max_ticks());
+        const auto exact = static_cast<long double>(ticks) * 1e9L / 2'893'412'345.6L;
+        const auto ns = static_cast<long double>(c.to_duration(ticks).count());
+        REQUIRE(std::abs(ns - exact) <= static_cast<long double>(c.max_error().count()) + 1);
+    }
+}
+
+TEST_CASE("tick converter converts durations to ticks", "[tick_converter]")
+{
+    using namespace ::frequencypp;
+
+    const auto c = tick_converter<std::chrono::microseconds>{32'768_Hz, std::chrono::hours{24}};
+    REQUIRE(c.to_ticks(std::chrono::seconds{1}) == 32'768);
+    REQUIRE(c.to_duration(32'768 * 3) == std::chrono::seconds{3});
+    for (std::uint64_t i = 0; i <= 1000; ++i) {
+        const auto us = sample(i, static_cast<std::uint64_t>(c.max_duration().count()));
+        const auto exact = (us * 32'768 + 500'000) / 1'000'000;
+        const auto ticks = c.to_ticks(std::chrono::microseconds{static_cast<std::int64_t>(us)});
+        REQUIRE(distance(ticks, exact) <= c.max_tick_error());
+    }
+}
+
+TEST_CASE("tick converter reports a range it cannot cover", "[tick_converter]")
+{
+    using namespace ::frequencypp;
+
+    // 3.6 * 10^18 ticks per hour leaves room for five hours in 64 bits, not the ten requested
+    constexpr auto per_hour = std::uint64_t{3'600'000'000'000'000'000};
+    const auto c = tick_converter<std::chrono::hours>{petahertz{1}, std::chrono::hours{10}};
+    REQUIRE(c.max_duration() == std::chrono::hours{5});
+    REQUIRE(c.to_ticks(std::chrono::hours{1}) == per_hour);
+    REQUIRE(c.to_ticks(std::chrono::hours{5}) == 5 * per_hour);
+
+    // A tick longer than 2^64 nanoseconds has no multiplier
+    const auto slow = tick_converter<std::chrono::nanoseconds>{frequency<double, std::nano>{0.01}};
+    REQUIRE(slow.max_ticks() == 0);
+}
+
+TEST_CASE("tick converter batch conversion matches scalar conversion", "[tick_converter]")
+{
+    using namespace ::frequencypp;
+
+    const auto c = tick_converter<>{1'000'000'007_Hz};
+    auto ticks = std::array<std::uint64_t, 17>{};
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+        ticks[i] = sample(i, c.max_ticks()) / 1000 * 1000;
+    }
+    auto ds = std::array<std::chrono::nanoseconds, 17>{};
+    c.to_duration(ticks.data(), ds.data(), ds.size());
+    auto back = std::array<std::uint64_t, 17>{};
+    c.to_ticks(ds.data(), back.data(), back.size());
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+        REQUIRE(ds[i] == c.to_duration(ticks[i]));
+        REQUIRE(back[i] == c.to_ticks(ds[i]));
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright 2021-2022 Jeremiah Griffin
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <frequencypp/views.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("cast views convert elements on dereference", "[views]")
+{
+    using namespace ::frequencypp;
+
+    const auto khz = std::vector<kilohertz>{kilohertz{1}, kilohertz{2}, kilohertz{3}};
+    const auto view = views::cast<hertz>(khz);
+    REQUIRE(view.size() == 3);
+    REQUIRE_FALSE(view.empty());
+    REQUIRE(*view.begin() == hertz{1000});
+    REQUIRE(view[2] == hertz{3000});
+    REQUIRE(std::accumulate(view.begin(), view.end(), hertz::zero()) == hertz{6000});
+
+    const auto copy = std::vector<hertz>(view.begin(), view.end());
+    REQUIRE(copy == std::vector<hertz>{hertz{1000}, hertz{2000}, hertz{3000}});
+}
+
+TEST_CASE("cast views truncate like frequency_cast", "[views]")
+{
+    using namespace ::frequencypp;
+
+    const hertz hz[] = {hertz{999}, hertz{1999}};
+    const auto view = views::cast<kilohertz>(hz);
+    REQUIRE(view[0] == kilohertz{0});
+    REQUIRE(view[1] == kilohertz{1});
+}
+
+TEST_CASE("cast views convert durations to frequencies", "[views]")
+{
+    using namespace ::frequencypp;
+    using std::chrono::milliseconds;
+
+    const auto periods = std::vector<milliseconds>{milliseconds{1}, milliseconds{4}};
+    const auto view = views::cast<hertz>(periods);
+    REQUIRE(view[0] == hertz{1000});
+    REQUIRE(view[1] == hertz{250});
+}
+
+TEST_CASE("cast iterators yielding values are input iterators", "[views]")
+{
+    using namespace ::frequencypp;
+
+    using vector_iterator = cast_iterator<hertz, std::vector<kilohertz>::const_iterator>;
+    using list_iterator = cast_iterator<hertz, std::list<kilohertz>::const_iterator>;
+    STATIC_REQUIRE(std::is_same_v<vector_iterator::iterator_category, std::input_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<list_iterator::iterator_category, std::input_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<vector_iterator::reference, hertz>);
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+    STATIC_REQUIRE(std::random_access_iterator<vector_iterator>);
+    STATIC_REQUIRE(std::bidirectional_iterator<list_iterator>);
+#endif
+
+    // The operations of the underlying iterator remain available
+    const auto khz = std::list<kilohertz>{kilohertz{1}, kilohertz{2}};
+    const auto view = views::cast<hertz>(khz);
+    REQUIRE(view.size() == 2);
+    auto last = view.end();
+    --last;
+    REQUIRE(*last == hertz{2000});
+}
+
+TEST_CASE("cast iterators support random access", "[views]")
+{
+    using namespace ::frequencypp;
+
+    const auto khz = std::vector<kilohertz>{kilohertz{1}, kilohertz{2}, kilohertz{3}};
+    const auto view = views::cast<hertz>(khz);
+    auto it = view.begin();
+    REQUIRE(view.end() - it == 3);
+    REQUIRE(*(it + 2) == hertz{3000});
+    REQUIRE(*(2 + it) == hertz{3000});
+    it += 2;
+    REQUIRE(*(it - 1) == hertz{2000});
+    REQUIRE(it[-2] == hertz{1000});
+    REQUIRE(view.begin() < it);
+    REQUIRE(it >= view.begin());
+    REQUIRE(it.base() == khz.begin() + 2);
+}
+
+TEST_CASE("cast views compose with other adaptors", "[views]")
+{
+    using namespace ::frequencypp;
+
+    const auto khz = std::vector<kilohertz>{kilohertz{1}, kilohertz{2}, kilohertz{3}};
+    const auto view = views::cast<hertz>(khz);
+    const auto reversed = std::vector<hertz>(
+        std::make_reverse_iterator(view.end()), std::make_reverse_iterator(view.begin()));
+    REQUIRE(reversed == std::vector<hertz>{hertz{3000}, hertz{2000}, hertz{1000}});
+
+    const auto twice = views::cast<megahertz>(views::cast<hertz>(khz));
+    REQUIRE(twice.size() == 3);
+    REQUIRE(twice[2] == megahertz{0});
+    REQUIRE(std::count(twice.begin(), twice.end(), megahertz{0}) == 3);
+}
+
+TEST_CASE("cast views are usable in constant expressions", "[views]")
+{
+    using namespace ::frequencypp;
+
+    static constexpr kilohertz khz[] = {kilohertz{1}, kilohertz{2}};
+    constexpr auto view = views::cast<hertz>(khz);
+    STATIC_REQUIRE(view.size() == 2);
+    STATIC_REQUIRE(view[1] == hertz{2000});
+}